@@ -0,0 +1,35 @@
+set(MICA_BENCH_SOURCES
+    allocation.cpp
+    bench.cpp
+    crossover_bench.cpp
+    format_bench.cpp
+    format_into_bench.cpp
+    io_bench.cpp
+    main.cpp
+    make_noexcept_bench.cpp
+    parallel_bench.cpp
+    parse_bench.cpp
+    report.cpp
+    result_bench.cpp
+    sampling_bench.cpp
+    task_bench.cpp
+    transform_bench.cpp
+    try_bench.cpp
+)
+
+prepend_paths(
+    "${MICA_BENCH_SOURCES}"
+    "src/mica_bench"
+    "MICA_BENCH_SOURCES"
+)
+
+# Compiled separately by the size benchmark, not part of the executable
+set(MICA_BENCH_SIZE_SOURCES
+    size_probe.cpp
+)
+
+prepend_paths(
+    "${MICA_BENCH_SIZE_SOURCES}"
+    "src/mica_bench"
+    "MICA_BENCH_SIZE_SOURCES"
+)
@@ -0,0 +1,168 @@
+# Reports the time to build COUNT synthetic translation units that use mica.
+# The same units are built twice: including mica/mica.hpp, and importing the
+# mica module with mica/try_macros.hpp for the macros. Each variant is a
+# separate project configured under OUTPUT_DIR and built from clean, the
+# module variant includes the time to build the module.
+#
+# Usage: cmake -DMICA_ROOT=<mica source> -DOUTPUT_DIR=<dir> -DCOUNT=<units>
+#     -DGENERATOR=<generator> -DMAKE_PROGRAM=<program> -DCXX_COMPILER=<compiler>
+#     -DBUILD_TYPE=<build type> -P build_time.cmake
+
+cmake_minimum_required(VERSION 4.0.0)
+
+foreach(var IN ITEMS MICA_ROOT OUTPUT_DIR COUNT GENERATOR MAKE_PROGRAM CXX_COMPILER BUILD_TYPE)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+# Writes the sources and CMakeLists.txt of variant into dir
+function(generate variant dir)
+    if(variant STREQUAL "module")
+        set(mica_include "#include <mica/try_macros.hpp>")
+        set(mica_import "\nimport mica;\n")
+        set(mica_target "mica::module")
+        set(scan ON)
+    else()
+        set(mica_include "#include <mica/mica.hpp>")
+        set(mica_import "")
+        set(mica_target "mica")
+        set(scan OFF)
+    endif()
+
+    set(sources "")
+    math(EXPR last "${COUNT} - 1")
+    foreach(index RANGE ${last})
+        set(source "unit_${index}.cpp")
+        file(CONFIGURE
+            OUTPUT "${dir}/${source}"
+            CONTENT [[
+#include <expected>
+@mica_include@
+#include <string>
+#include <utility>
+@mica_import@
+namespace synthetic {
+
+int parse_@index@(const std::string& text)
+{
+    return std::stoi(text) + @index@;
+}
+
+std::expected<std::string, std::string> describe_@index@(const std::string& text) noexcept
+{
+    MICA_TRY_DECL(int value, mica::make_noexcept<&parse_@index@>(text));
+    return mica::format("{}: {}", @index@, value);
+}
+
+} // namespace synthetic
+]]
+            @ONLY
+        )
+        string(APPEND sources "\n    ${source}")
+    endforeach()
+
+    file(CONFIGURE
+        OUTPUT "${dir}/CMakeLists.txt"
+        CONTENT [[
+cmake_minimum_required(VERSION 4.0.0)
+project(mica_build_time_@variant@ LANGUAGES CXX)
+set(CMAKE_CXX_SCAN_FOR_MODULES @scan@)
+add_subdirectory("@MICA_ROOT@" mica)
+add_library(synthetic STATIC@sources@
+)
+target_compile_features(synthetic PRIVATE cxx_std_23)
+target_link_libraries(synthetic PRIVATE @mica_target@)
+]]
+        @ONLY
+    )
+endfunction()
+
+# Configures and builds variant, returns the build time in milliseconds in
+# the value of result_var
+function(build variant result_var)
+    set(source_dir "${OUTPUT_DIR}/${variant}")
+    set(binary_dir "${OUTPUT_DIR}/${variant}/build")
+    if(variant STREQUAL "module")
+        set(module ON)
+    else()
+        set(module OFF)
+    endif()
+    generate(${variant} "${source_dir}")
+
+    execute_process(
+        COMMAND "${CMAKE_COMMAND}"
+            -S "${source_dir}"
+            -B "${binary_dir}"
+            -G "${GENERATOR}"
+            "-DCMAKE_MAKE_PROGRAM=${MAKE_PROGRAM}"
+            "-DCMAKE_CXX_COMPILER=${CXX_COMPILER}"
+            "-DCMAKE_BUILD_TYPE=${BUILD_TYPE}"
+            "-DMICA_MODULE=${module}"
+        OUTPUT_QUIET
+        RESULT_VARIABLE configure_result
+    )
+    if(NOT configure_result EQUAL 0)
+        message(FATAL_ERROR "Configuring the ${variant} variant failed")
+    endif()
+
+    string(TIMESTAMP start "%s%f" UTC)
+    execute_process(
+        COMMAND "${CMAKE_COMMAND}" --build "${binary_dir}" --clean-first --parallel
+        OUTPUT_QUIET
+        RESULT_VARIABLE build_result
+    )
+    string(TIMESTAMP stop "%s%f" UTC)
+    if(NOT build_result EQUAL 0)
+        message(FATAL_ERROR "Building the ${variant} variant failed")
+    endif()
+
+    math(EXPR milliseconds "(${stop} - ${start}) / 1000")
+    set(${result_var} ${milliseconds} PARENT_SCOPE)
+endfunction()
+
+# Hundredths as a number with two decimals, math() only handles integers
+function(fixed_point hundredths result_var)
+    math(EXPR whole "${hundredths} / 100")
+    math(EXPR fraction "${hundredths} % 100")
+    if(fraction LESS 10)
+        set(fraction "0${fraction}")
+    endif()
+    set(${result_var} "${whole}.${fraction}" PARENT_SCOPE)
+endfunction()
+
+# Appends text to row_var, right aligned in a column of width characters
+function(append_column row_var text width)
+    string(LENGTH "${text}" length)
+    math(EXPR padding "${width} - ${length}")
+    if(padding LESS 1)
+        set(padding 1)
+    endif()
+    string(REPEAT " " ${padding} pad)
+    set(${row_var} "${${row_var}}${pad}${text}" PARENT_SCOPE)
+endfunction()
+
+string(REPEAT " " 10 pad)
+set(header "variant${pad}")
+foreach(column IN ITEMS "total ms" "ms per unit" "vs header")
+    append_column(header "${column}" 14)
+endforeach()
+
+set(report "build time of ${COUNT} translation units, ${BUILD_TYPE}\n${header}")
+foreach(variant IN ITEMS header module)
+    build(${variant} milliseconds_${variant})
+    string(LENGTH "${variant}" variant_length)
+    math(EXPR padding "17 - ${variant_length}")
+    string(REPEAT " " ${padding} pad)
+    set(row "${variant}${pad}")
+    append_column(row "${milliseconds_${variant}}" 14)
+    math(EXPR per_unit "(${milliseconds_${variant}} * 100) / ${COUNT}")
+    fixed_point(${per_unit} per_unit)
+    append_column(row "${per_unit}" 14)
+    math(EXPR ratio "(${milliseconds_${variant}} * 100) / ${milliseconds_header}")
+    fixed_point(${ratio} ratio)
+    append_column(row "${ratio}x" 14)
+    string(APPEND report "\n${row}")
+endforeach()
+
+message("${report}")
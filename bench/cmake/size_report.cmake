@@ -0,0 +1,95 @@
+# Reports the code size each make_noexcept instantiation adds to an object.
+# The sections of every variant object are measured with objdump and compared
+# with BASELINE, an object with no instantiations.
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DCOUNT=<instantiations> -DBASELINE=<object>
+#     -DVARIANTS=<name;...> -DOBJECT_<name>=<object> -P size_report.cmake
+
+cmake_minimum_required(VERSION 4.0.0)
+
+foreach(var IN ITEMS OBJDUMP COUNT BASELINE VARIANTS)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+# Sums the section sizes of object into <prefix>_hot (.text), <prefix>_cold
+# (.text.unlikely) and <prefix>_unwind (.eh_frame, .gcc_except_table)
+function(measure object prefix)
+    execute_process(
+        COMMAND "${OBJDUMP}" --section-headers "${object}"
+        OUTPUT_VARIABLE headers
+        RESULT_VARIABLE objdump_result
+    )
+    if(NOT objdump_result EQUAL 0)
+        message(FATAL_ERROR "${OBJDUMP} failed on ${object}")
+    endif()
+    string(REPLACE "\n" ";" lines "${headers}")
+    set(hot 0)
+    set(cold 0)
+    set(unwind 0)
+    foreach(line IN LISTS lines)
+        if(NOT line MATCHES "^ *[0-9]+ +([^ ]+) +([0-9a-f]+) ")
+            continue()
+        endif()
+        set(section "${CMAKE_MATCH_1}")
+        math(EXPR size "0x${CMAKE_MATCH_2}")
+        if(section MATCHES "^\\.text\\.unlikely")
+            math(EXPR cold "${cold} + ${size}")
+        elseif(section MATCHES "^\\.text")
+            math(EXPR hot "${hot} + ${size}")
+        elseif(section MATCHES "^\\.(eh_frame|gcc_except_table)")
+            math(EXPR unwind "${unwind} + ${size}")
+        endif()
+    endforeach()
+    set(${prefix}_hot ${hot} PARENT_SCOPE)
+    set(${prefix}_cold ${cold} PARENT_SCOPE)
+    set(${prefix}_unwind ${unwind} PARENT_SCOPE)
+endfunction()
+
+# Bytes per instantiation with two decimals, math() only handles integers
+function(per_instantiation bytes result_var)
+    math(EXPR hundredths "(${bytes} * 100) / ${COUNT}")
+    math(EXPR whole "${hundredths} / 100")
+    math(EXPR fraction "${hundredths} % 100")
+    if(fraction LESS 10)
+        set(fraction "0${fraction}")
+    endif()
+    set(${result_var} "${whole}.${fraction}" PARENT_SCOPE)
+endfunction()
+
+# Appends text to row_var, right aligned in a column of width characters
+function(append_column row_var text width)
+    string(LENGTH "${text}" length)
+    math(EXPR padding "${width} - ${length}")
+    if(padding LESS 1)
+        set(padding 1)
+    endif()
+    string(REPEAT " " ${padding} pad)
+    set(${row_var} "${${row_var}}${pad}${text}" PARENT_SCOPE)
+endfunction()
+
+measure("${BASELINE}" baseline)
+
+string(REPEAT " " 25 pad)
+set(header "variant${pad}")
+foreach(column IN ITEMS "hot text" "cold text" "unwind")
+    append_column(header "${column}" 12)
+endforeach()
+
+set(report "bytes per instantiation, ${COUNT} instantiations\n${header}")
+foreach(variant IN LISTS VARIANTS)
+    measure("${OBJECT_${variant}}" variant)
+    string(LENGTH "${variant}" variant_length)
+    math(EXPR padding "32 - ${variant_length}")
+    string(REPEAT " " ${padding} pad)
+    set(row "${variant}${pad}")
+    foreach(kind IN ITEMS hot cold unwind)
+        math(EXPR bytes "${variant_${kind}} - ${baseline_${kind}}")
+        per_instantiation(${bytes} value)
+        append_column(row "${value}" 12)
+    endforeach()
+    string(APPEND report "\n${row}")
+endforeach()
+
+message("${report}")
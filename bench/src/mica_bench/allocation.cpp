@@ -0,0 +1,61 @@
+#include <mica_bench/bench.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace mica_bench {
+
+namespace {
+
+std::atomic<std::size_t> allocations(0);
+
+} // unnamed namespace
+
+std::size_t allocation_count() noexcept
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+} // namespace mica_bench
+
+// The remaining replaceable forms forward to these by default
+void* operator new(std::size_t size)
+{
+    mica_bench::allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    mica_bench::allocations.fetch_add(1, std::memory_order_relaxed);
+    auto align = static_cast<std::size_t>(alignment);
+    size = (size + align - 1) / align * align;
+    if (void* p = std::aligned_alloc(align, size == 0 ? align : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
@@ -0,0 +1,179 @@
+#include <mica_bench/bench.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr std::chrono::milliseconds MIN_TIME(100);
+
+constexpr std::size_t MAX_ITERATIONS = 1'000'000'000;
+
+struct registration {
+    const char* name;
+    bench_function function;
+};
+
+struct summary_registration {
+    const char* name;
+    summary_function function;
+};
+
+std::vector<registration>& registry()
+{
+    static std::vector<registration> benches;
+    return benches;
+}
+
+std::vector<summary_registration>& summary_registry()
+{
+    static std::vector<summary_registration> summaries;
+    return summaries;
+}
+
+state measure(bench_function function, std::size_t iterations)
+{
+    state s(iterations);
+    function(s);
+    return s;
+}
+
+} // unnamed namespace
+
+state::iterator::iterator(state& s) noexcept
+    : state_(&s)
+{}
+
+state::iterator& state::iterator::operator++() noexcept
+{
+    --state_->remaining_;
+    return *this;
+}
+
+state::iteration state::iterator::operator*() const noexcept
+{
+    return iteration();
+}
+
+bool state::iterator::operator!=(sentinel) noexcept
+{
+    if (state_->remaining_ == 0) [[unlikely]] {
+        state_->stop();
+        return false;
+    }
+    return true;
+}
+
+state::state(std::size_t iterations) noexcept
+    : iterations_(iterations),
+      remaining_(iterations),
+      start_time_(),
+      elapsed_(0),
+      start_allocations_(0),
+      allocations_(0)
+{}
+
+state::iterator state::begin() noexcept
+{
+    start();
+    return iterator(*this);
+}
+
+state::sentinel state::end() noexcept
+{
+    return sentinel();
+}
+
+std::size_t state::iterations() const noexcept
+{
+    return iterations_;
+}
+
+std::chrono::nanoseconds state::elapsed() const noexcept
+{
+    return elapsed_;
+}
+
+std::size_t state::allocations() const noexcept
+{
+    return allocations_;
+}
+
+void state::start() noexcept
+{
+    start_allocations_ = allocation_count();
+    start_time_ = std::chrono::steady_clock::now();
+}
+
+void state::stop() noexcept
+{
+    elapsed_ = std::chrono::steady_clock::now() - start_time_;
+    allocations_ = allocation_count() - start_allocations_;
+}
+
+void register_bench(const char* name, bench_function function)
+{
+    registry().push_back({name, function});
+}
+
+void register_summary(const char* name, summary_function function)
+{
+    summary_registry().push_back({name, function});
+}
+
+// Doubles the iteration count until a run takes at least MIN_TIME. The
+// shorter runs double as warm-up.
+std::vector<result> run(const std::string& filter)
+{
+    std::vector<result> results;
+    for (auto&& [name, function] : registry()) {
+        if (std::string(name).find(filter) == std::string::npos) {
+            continue;
+        }
+        std::size_t iterations = 1;
+        state s = measure(function, iterations);
+        while (s.elapsed() < MIN_TIME && iterations < MAX_ITERATIONS) {
+            iterations *= 2;
+            s = measure(function, iterations);
+        }
+        results.push_back({
+            name,
+            s.iterations(),
+            static_cast<double>(s.elapsed().count()) / static_cast<double>(s.iterations()),
+            static_cast<double>(s.allocations()) / static_cast<double>(s.iterations()),
+        });
+    }
+    return results;
+}
+
+std::vector<summary> summarize(const std::vector<result>& results)
+{
+    std::vector<summary> summaries;
+    for (auto&& [name, function] : summary_registry()) {
+        summaries.push_back({name, function(results)});
+    }
+    return summaries;
+}
+
+const result* find(const std::vector<result>& results, const std::string& name) noexcept
+{
+    auto it = std::find_if(results.begin(), results.end(), [&name](const result& r) {
+        return r.name == name;
+    });
+    return it == results.end() ? nullptr : &*it;
+}
+
+registrar::registrar(const char* name, bench_function function)
+{
+    register_bench(name, function);
+}
+
+registrar::registrar(const char* name, summary_function function)
+{
+    register_summary(name, function);
+}
+
+} // namespace mica_bench
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <mica/macro.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace mica_bench {
+
+// Number of calls to the global operator new since program start
+std::size_t allocation_count() noexcept;
+
+// Prevent the compiler from discarding value
+template<typename T>
+inline void do_not_optimize(const T& value) noexcept
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Measured region of a benchmark, iterate it with a range-for loop
+class state {
+public:
+    class sentinel {};
+
+    struct [[maybe_unused]] iteration {};
+
+    class iterator {
+    public:
+        explicit iterator(state& s) noexcept;
+
+        iterator& operator++() noexcept;
+
+        iteration operator*() const noexcept;
+
+        bool operator!=(sentinel) noexcept;
+
+    private:
+        state* state_;
+    };
+
+    explicit state(std::size_t iterations) noexcept;
+
+    iterator begin() noexcept;
+
+    sentinel end() noexcept;
+
+    std::size_t iterations() const noexcept;
+
+    std::chrono::nanoseconds elapsed() const noexcept;
+
+    std::size_t allocations() const noexcept;
+
+private:
+    void start() noexcept;
+
+    void stop() noexcept;
+
+    std::size_t iterations_;
+    std::size_t remaining_;
+    std::chrono::steady_clock::time_point start_time_;
+    std::chrono::nanoseconds elapsed_;
+    std::size_t start_allocations_;
+    std::size_t allocations_;
+};
+
+using bench_function = void (*)(state&);
+
+struct result {
+    std::string name;
+    std::size_t iterations;
+    double ns_per_iteration;
+    double allocations_per_iteration;
+};
+
+// Value derived from the results of several benchmarks, nullopt when the
+// benchmarks it needs were filtered out or no value could be derived
+using summary_function = std::optional<double> (*)(const std::vector<result>&);
+
+struct summary {
+    std::string name;
+    std::optional<double> value;
+};
+
+void register_bench(const char* name, bench_function function);
+
+void register_summary(const char* name, summary_function function);
+
+// Runs every benchmark whose name contains filter
+std::vector<result> run(const std::string& filter);
+
+std::vector<summary> summarize(const std::vector<result>& results);
+
+// Looks up a result by name
+const result* find(const std::vector<result>& results, const std::string& name) noexcept;
+
+void report_text(std::FILE* out, const std::vector<result>& results, const std::vector<summary>& summaries);
+
+void report_json(std::FILE* out, const std::vector<result>& results, const std::vector<summary>& summaries);
+
+struct registrar {
+    registrar(const char* name, bench_function function);
+
+    registrar(const char* name, summary_function function);
+};
+
+} // namespace mica_bench
+
+#define MICA_BENCH(name_, function_) \
+    static const mica_bench::registrar MICA_TMP_VAR(_mica_bench_registrar_)(name_, function_)
+
+#define MICA_BENCH_SUMMARY(name_, function_) \
+    static const mica_bench::registrar MICA_TMP_VAR(_mica_bench_summary_)( \
+        name_, \
+        static_cast<mica_bench::summary_function>(function_) \
+    )
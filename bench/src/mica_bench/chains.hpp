@@ -0,0 +1,41 @@
+#pragma once
+
+#include <expected>
+#include <mica/mica.hpp>
+#include <stdexcept>
+
+namespace mica_bench {
+
+// Chains of Depth calls that fail at the innermost one for a negative value,
+// returning an error through MICA_TRY or throwing. Both sides are kept out of
+// line so each level is a real call.
+
+template<int Depth>
+[[gnu::noinline]] std::expected<int, mica::error> expected_chain(int value) noexcept
+{
+    if constexpr (Depth == 0) {
+        if (value < 0) {
+            return std::unexpected(mica::errc::invalid_argument);
+        }
+        return value;
+    } else {
+        int output = 0;
+        MICA_TRY(output, expected_chain<Depth - 1>(value));
+        return output + 1;
+    }
+}
+
+template<int Depth>
+[[gnu::noinline]] int exception_chain(int value)
+{
+    if constexpr (Depth == 0) {
+        if (value < 0) {
+            throw std::invalid_argument("negative value");
+        }
+        return value;
+    } else {
+        return exception_chain<Depth - 1>(value) + 1;
+    }
+}
+
+} // namespace mica_bench
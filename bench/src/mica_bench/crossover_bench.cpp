@@ -0,0 +1,95 @@
+#include <mica_bench/bench.hpp>
+#include <mica_bench/chains.hpp>
+
+#include <expected>
+#include <mica/mica.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr int DEPTH = 8;
+
+// Failure rates are 1 / Period, Period 0 never fails
+constexpr int PERIODS[] = {0, 10000, 1000, 100, 10, 2};
+
+template<int Period>
+int next_input(int& i) noexcept
+{
+    ++i;
+    if constexpr (Period == 0) {
+        return i & 0xffff;
+    } else {
+        return i % Period == 0 ? -1 : i & 0xffff;
+    }
+}
+
+template<int Period>
+void expected_rate(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        do_not_optimize(expected_chain<DEPTH>(next_input<Period>(i)));
+    }
+}
+
+template<int Period>
+void exception_rate(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        try {
+            do_not_optimize(exception_chain<DEPTH>(next_input<Period>(i)));
+        } catch (const std::exception& e) {
+            do_not_optimize(e.what());
+        }
+    }
+}
+
+std::string rate_name(const char* kind, int period)
+{
+    return std::string("crossover/") + kind + "/period=" + std::to_string(period);
+}
+
+// Lowest measured failure rate at which expected is at least as fast as
+// exceptions
+std::optional<double> crossover_failure_rate(const std::vector<result>& results)
+{
+    std::optional<double> crossover;
+    for (int period : PERIODS) {
+        auto* expected = find(results, rate_name("expected", period));
+        auto* exception = find(results, rate_name("exception", period));
+        if (expected == nullptr || exception == nullptr) {
+            return std::nullopt;
+        }
+        double rate = period == 0 ? 0.0 : 1.0 / period;
+        if (expected->ns_per_iteration <= exception->ns_per_iteration) {
+            if (!crossover.has_value() || rate < *crossover) {
+                crossover = rate;
+            }
+        }
+    }
+    return crossover;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("crossover/expected/period=0", expected_rate<0>);
+MICA_BENCH("crossover/exception/period=0", exception_rate<0>);
+MICA_BENCH("crossover/expected/period=10000", expected_rate<10000>);
+MICA_BENCH("crossover/exception/period=10000", exception_rate<10000>);
+MICA_BENCH("crossover/expected/period=1000", expected_rate<1000>);
+MICA_BENCH("crossover/exception/period=1000", exception_rate<1000>);
+MICA_BENCH("crossover/expected/period=100", expected_rate<100>);
+MICA_BENCH("crossover/exception/period=100", exception_rate<100>);
+MICA_BENCH("crossover/expected/period=10", expected_rate<10>);
+MICA_BENCH("crossover/exception/period=10", exception_rate<10>);
+MICA_BENCH("crossover/expected/period=2", expected_rate<2>);
+MICA_BENCH("crossover/exception/period=2", exception_rate<2>);
+
+MICA_BENCH_SUMMARY("crossover/failure_rate", crossover_failure_rate);
+
+} // namespace mica_bench
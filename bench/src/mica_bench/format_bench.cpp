@@ -0,0 +1,106 @@
+#include <mica_bench/bench.hpp>
+
+#include <format>
+#include <mica/mica.hpp>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr std::string_view PAYLOAD = "request completed without errors";
+
+constexpr std::string_view PATH = "/api/v1/orders";
+
+void std_format(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        auto&& output = std::format("id={} status={} msg={}", ++i, 200, PAYLOAD);
+        do_not_optimize(output);
+    }
+}
+
+void mica_format(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::format("id={} status={} msg={}", ++i, 200, PAYLOAD);
+        do_not_optimize(exp);
+    }
+}
+
+void mica_format_error(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::format<mica::error>("id={} status={} msg={}", ++i, 200, PAYLOAD);
+        do_not_optimize(exp);
+    }
+}
+
+// An access log line mixing strings, integers and a double
+void std_format_log_line(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        auto&& output = std::format("{} {} status={} bytes={} elapsed_ms={}", "GET", PATH, 200, ++i, 12.5);
+        do_not_optimize(output);
+    }
+}
+
+void mica_format_log_line(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::format("{} {} status={} bytes={} elapsed_ms={}", "GET", PATH, 200, ++i, 12.5);
+        do_not_optimize(exp);
+    }
+}
+
+// Format specs are not planned, mica::format goes through std::format
+void std_format_specs(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        auto&& output = std::format("id={:08} status={:>4}", ++i, 200);
+        do_not_optimize(output);
+    }
+}
+
+void mica_format_specs(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::format("id={:08} status={:>4}", ++i, 200);
+        do_not_optimize(exp);
+    }
+}
+
+// Time per log line through std::format divided by the time through
+// mica::format
+std::optional<double> log_line_speedup(const std::vector<result>& results)
+{
+    const result* std_format = find(results, "format/log_line/std_format");
+    const result* mica_format = find(results, "format/log_line/mica_format");
+    if (std_format == nullptr || mica_format == nullptr || mica_format->ns_per_iteration <= 0) {
+        return std::nullopt;
+    }
+    return std_format->ns_per_iteration / mica_format->ns_per_iteration;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("format/std_format", std_format);
+MICA_BENCH("format/mica_format/string", mica_format);
+MICA_BENCH("format/mica_format/error", mica_format_error);
+MICA_BENCH("format/log_line/std_format", std_format_log_line);
+MICA_BENCH("format/log_line/mica_format", mica_format_log_line);
+MICA_BENCH("format/specs/std_format", std_format_specs);
+MICA_BENCH("format/specs/mica_format", mica_format_specs);
+
+MICA_BENCH_SUMMARY("format/log_line_speedup", log_line_speedup);
+
+} // namespace mica_bench
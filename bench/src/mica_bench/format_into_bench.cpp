@@ -0,0 +1,41 @@
+#include <mica_bench/bench.hpp>
+
+#include <mica/mica.hpp>
+#include <string>
+#include <string_view>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr std::string_view PAYLOAD = "request completed without errors";
+
+void format_fresh_string(state& s)
+{
+    int i = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::format("id={} status={} msg={}", ++i, 200, PAYLOAD);
+        do_not_optimize(exp);
+    }
+}
+
+// One warm-up call sizes the string, the measured loop must not allocate
+void format_into_reused_string(state& s)
+{
+    std::string output;
+    auto&& warm_up = mica::format_into(output, "id={} status={} msg={}", 1'000'000'000, 200, PAYLOAD);
+    do_not_optimize(warm_up);
+    int i = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::format_into(output, "id={} status={} msg={}", ++i, 200, PAYLOAD);
+        do_not_optimize(exp);
+        do_not_optimize(output);
+    }
+}
+
+} // unnamed namespace
+
+MICA_BENCH("format/fresh_string", format_fresh_string);
+MICA_BENCH("format_into/reused_string", format_into_reused_string);
+
+} // namespace mica_bench
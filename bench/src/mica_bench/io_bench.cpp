@@ -0,0 +1,94 @@
+#include <mica_bench/bench.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mica/mica.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr std::size_t FILE_SIZE = 1 << 20;
+
+// Written once, on first use
+const std::filesystem::path& input_path()
+{
+    static const std::filesystem::path path = [] {
+        std::filesystem::path output = std::filesystem::temp_directory_path() / "mica_io_bench";
+        std::ofstream file(output, std::ios::binary);
+        for (std::size_t i = 0; i < FILE_SIZE; ++i) {
+            file.put(static_cast<char>('a' + i % 26));
+        }
+        return output;
+    }();
+    return path;
+}
+
+std::size_t checksum(std::string_view text) noexcept
+{
+    std::size_t sum = 0;
+    for (char c : text) {
+        sum += static_cast<unsigned char>(c);
+    }
+    return sum;
+}
+
+std::string read_stream(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    file.exceptions(std::ios::failbit | std::ios::badbit);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void ifstream_read(state& s)
+{
+    const std::filesystem::path& path = input_path();
+    for (auto _ : s) {
+        auto&& text = mica::make_noexcept<read_stream>(path);
+        do_not_optimize(checksum(*text));
+    }
+}
+
+void read_all(state& s)
+{
+    const std::filesystem::path& path = input_path();
+    for (auto _ : s) {
+        auto&& bytes = mica::io::read_all(path);
+        do_not_optimize(checksum(std::string_view(reinterpret_cast<const char*>(bytes->data()), bytes->size())));
+    }
+}
+
+void map_file(state& s)
+{
+    const std::filesystem::path& path = input_path();
+    for (auto _ : s) {
+        auto&& mapping = mica::io::map_file(path);
+        do_not_optimize(checksum(mapping->text()));
+    }
+}
+
+// Time per file of the ifstream read divided by the time of map_file
+std::optional<double> map_file_speedup(const std::vector<result>& results)
+{
+    const result* stream = find(results, "io/ifstream/1MiB");
+    const result* mapped = find(results, "io/map_file/1MiB");
+    if (stream == nullptr || mapped == nullptr || mapped->ns_per_iteration <= 0) {
+        return std::nullopt;
+    }
+    return stream->ns_per_iteration / mapped->ns_per_iteration;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("io/ifstream/1MiB", ifstream_read);
+MICA_BENCH("io/read_all/1MiB", read_all);
+MICA_BENCH("io/map_file/1MiB", map_file);
+
+MICA_BENCH_SUMMARY("io/map_file_speedup", map_file_speedup);
+
+} // namespace mica_bench
@@ -0,0 +1,32 @@
+#include <mica_bench/bench.hpp>
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+int main(int argc, char** argv)
+{
+    std::string filter;
+    bool json = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        if (arg.starts_with("--filter=")) {
+            filter = arg.substr(9);
+        } else if (arg == "--format=json") {
+            json = true;
+        } else if (arg == "--format=text") {
+            json = false;
+        } else {
+            std::fprintf(stderr, "usage: %s [--filter=<substring>] [--format=text|json]\n", argv[0]);
+            return 1;
+        }
+    }
+    auto&& results = mica_bench::run(filter);
+    auto&& summaries = mica_bench::summarize(results);
+    if (json) {
+        mica_bench::report_json(stdout, results, summaries);
+    } else {
+        mica_bench::report_text(stdout, results, summaries);
+    }
+    return 0;
+}
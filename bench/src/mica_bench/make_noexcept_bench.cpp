@@ -0,0 +1,134 @@
+#include <mica_bench/bench.hpp>
+
+#include <mica/mica.hpp>
+#include <stdexcept>
+
+namespace mica_bench {
+
+namespace {
+
+[[gnu::noinline]] int checked_increment(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument("negative value");
+    }
+    return value + 1;
+}
+
+class counter {
+public:
+    [[gnu::noinline]] int increment(int value) const
+    {
+        return checked_increment(value);
+    }
+};
+
+void direct_call(state& s)
+{
+    int value = 0;
+    for (auto _ : s) {
+        value = checked_increment(value & 0xffff);
+        do_not_optimize(value);
+    }
+}
+
+void free_function_success(state& s)
+{
+    int value = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::make_noexcept<checked_increment>(value & 0xffff);
+        value = *exp;
+        do_not_optimize(value);
+    }
+}
+
+void member_function_success(state& s)
+{
+    counter c;
+    int value = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::make_noexcept<&counter::increment>(c, value & 0xffff);
+        value = *exp;
+        do_not_optimize(value);
+    }
+}
+
+void capturing_lambda_success(state& s)
+{
+    int offset = 0;
+    do_not_optimize(offset);
+    int value = 0;
+    for (auto _ : s) {
+        auto&& exp = mica::make_noexcept([&offset](int v) -> int {
+            return checked_increment(v + offset);
+        }, value & 0xffff);
+        value = *exp;
+        do_not_optimize(value);
+    }
+}
+
+void native_exception_failure(state& s)
+{
+    int value = -1;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        try {
+            do_not_optimize(checked_increment(value));
+        } catch (const std::exception& e) {
+            do_not_optimize(e.what());
+        }
+    }
+}
+
+template<typename Policy>
+void free_function_failure(state& s)
+{
+    int value = -1;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        auto&& exp = mica::make_noexcept<checked_increment, Policy>(value);
+        do_not_optimize(exp);
+    }
+}
+
+template<typename Policy>
+void member_function_failure(state& s)
+{
+    counter c;
+    int value = -1;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        auto&& exp = mica::make_noexcept<&counter::increment, Policy>(c, value);
+        do_not_optimize(exp);
+    }
+}
+
+template<typename Policy>
+void capturing_lambda_failure(state& s)
+{
+    int offset = -1;
+    do_not_optimize(offset);
+    for (auto _ : s) {
+        auto&& exp = mica::make_noexcept<Policy>([&offset](int v) -> int {
+            return checked_increment(v + offset);
+        }, 0);
+        do_not_optimize(exp);
+    }
+}
+
+} // unnamed namespace
+
+MICA_BENCH("make_noexcept/success/direct_call", direct_call);
+MICA_BENCH("make_noexcept/success/free_function", free_function_success);
+MICA_BENCH("make_noexcept/success/member_function", member_function_success);
+MICA_BENCH("make_noexcept/success/capturing_lambda", capturing_lambda_success);
+
+MICA_BENCH("make_noexcept/failure/native_exception", native_exception_failure);
+MICA_BENCH("make_noexcept/failure/free_function/string", free_function_failure<std::string>);
+MICA_BENCH("make_noexcept/failure/free_function/error", free_function_failure<mica::error>);
+MICA_BENCH("make_noexcept/failure/member_function/string", member_function_failure<std::string>);
+MICA_BENCH("make_noexcept/failure/member_function/error", member_function_failure<mica::error>);
+MICA_BENCH("make_noexcept/failure/capturing_lambda/string", capturing_lambda_failure<std::string>);
+MICA_BENCH("make_noexcept/failure/capturing_lambda/error", capturing_lambda_failure<mica::error>);
+
+} // namespace mica_bench
@@ -0,0 +1,93 @@
+#include <mica_bench/bench.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mica/mica.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr std::size_t BATCH_SIZE = 1 << 18;
+
+[[gnu::noinline]] double score_record(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument("negative record");
+    }
+    // Enough work per element that scaling is not bound by memory bandwidth
+    double score = value;
+    for (int i = 0; i < 32; ++i) {
+        score = score * 0.5 + i;
+    }
+    return score;
+}
+
+const std::vector<int>& batch()
+{
+    static const std::vector<int> records = []() {
+        std::vector<int> output(BATCH_SIZE);
+        for (std::size_t i = 0; i < BATCH_SIZE; ++i) {
+            output[i] = i % 10000 == 9999 ? -1 : static_cast<int>(i);
+        }
+        return output;
+    }();
+    return records;
+}
+
+std::size_t max_threads() noexcept
+{
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+template<std::size_t Threads>
+void parallel_transform(state& s)
+{
+    // Zero means every hardware thread
+    mica::thread_pool pool(Threads == 0 ? max_threads() : Threads);
+    mica::columnar_result<double> output;
+    for (auto _ : s) {
+        output.clear();
+        do_not_optimize(mica::parallel_transform_noexcept<score_record>(batch(), output, pool));
+        do_not_optimize(output.values().data());
+    }
+}
+
+void sequential_transform(state& s)
+{
+    mica::columnar_result<double> output;
+    for (auto _ : s) {
+        output.clear();
+        do_not_optimize(mica::transform_noexcept<score_record>(batch(), output));
+        do_not_optimize(output.values().data());
+    }
+}
+
+// Speedup of every hardware thread over a single worker
+std::optional<double> parallel_speedup(const std::vector<result>& results)
+{
+    auto* single = find(results, "parallel/threads=1");
+    auto* all = find(results, "parallel/threads=all");
+    if (single == nullptr || all == nullptr) {
+        return std::nullopt;
+    }
+    return single->ns_per_iteration / all->ns_per_iteration;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("parallel/sequential", sequential_transform);
+MICA_BENCH("parallel/threads=1", parallel_transform<1>);
+MICA_BENCH("parallel/threads=2", parallel_transform<2>);
+MICA_BENCH("parallel/threads=4", parallel_transform<4>);
+MICA_BENCH("parallel/threads=8", parallel_transform<8>);
+MICA_BENCH("parallel/threads=all", parallel_transform<0>);
+
+MICA_BENCH_SUMMARY("parallel/speedup", parallel_speedup);
+
+} // namespace mica_bench
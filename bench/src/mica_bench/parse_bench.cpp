@@ -0,0 +1,93 @@
+#include <mica_bench/bench.hpp>
+
+#include <cstddef>
+#include <expected>
+#include <mica/mica.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr std::size_t COLUMN_SIZE = 1000;
+
+int stoi(const std::string& text)
+{
+    return std::stoi(text);
+}
+
+// std::stoi accepts trailing garbage, so the malformed field starts with it
+template<bool Valid>
+void stoi_bench(state& s)
+{
+    const std::string text = Valid ? "12345678" : "x2345678";
+    for (auto _ : s) {
+        auto&& exp = mica::make_noexcept<stoi>(text);
+        do_not_optimize(exp);
+    }
+}
+
+template<bool Valid>
+void parse_bench(state& s)
+{
+    std::string_view text = Valid ? "12345678" : "x2345678";
+    do_not_optimize(text);
+    for (auto _ : s) {
+        auto&& exp = mica::parse<int, mica::error>(text);
+        do_not_optimize(exp);
+    }
+}
+
+// One field in ten is malformed
+std::string make_column()
+{
+    std::string output;
+    for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+        if (i % 10 == 9) {
+            output += "n/a";
+        } else {
+            output += std::to_string(i * 7919 % 1000003);
+        }
+        output += '\n';
+    }
+    return output;
+}
+
+void parse_column_bench(state& s)
+{
+    const std::string column = make_column();
+    mica::try_vector<std::expected<int, mica::errc>> output;
+    for (auto _ : s) {
+        output.clear();
+        auto&& exp = mica::parse_column<int, mica::error>(column, '\n', output);
+        do_not_optimize(exp);
+        do_not_optimize(output.data());
+    }
+}
+
+// Time per malformed field through std::stoi divided by the time through
+// mica::parse
+std::optional<double> malformed_speedup(const std::vector<result>& results)
+{
+    const result* stoi = find(results, "parse/stoi/malformed");
+    const result* parse = find(results, "parse/parse/malformed");
+    if (stoi == nullptr || parse == nullptr || parse->ns_per_iteration <= 0) {
+        return std::nullopt;
+    }
+    return stoi->ns_per_iteration / parse->ns_per_iteration;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("parse/stoi/valid", stoi_bench<true>);
+MICA_BENCH("parse/stoi/malformed", stoi_bench<false>);
+MICA_BENCH("parse/parse/valid", parse_bench<true>);
+MICA_BENCH("parse/parse/malformed", parse_bench<false>);
+MICA_BENCH("parse/parse_column/1000", parse_column_bench);
+
+MICA_BENCH_SUMMARY("parse/malformed_speedup", malformed_speedup);
+
+} // namespace mica_bench
@@ -0,0 +1,93 @@
+#include <mica_bench/bench.hpp>
+
+#include <cstdio>
+#include <string>
+
+#ifndef MICA_BENCH_VERSION
+#define MICA_BENCH_VERSION "unknown"
+#endif
+
+namespace mica_bench {
+
+namespace {
+
+std::string json_string(const std::string& value)
+{
+    std::string output("\"");
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            output += '\\';
+            output += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            output += escaped;
+        } else {
+            output += c;
+        }
+    }
+    output += '"';
+    return output;
+}
+
+} // unnamed namespace
+
+void report_text(std::FILE* out, const std::vector<result>& results, const std::vector<summary>& summaries)
+{
+    std::fprintf(out, "%-48s %14s %14s %14s\n", "benchmark", "iterations", "ns/iter", "allocs/iter");
+    for (auto&& r : results) {
+        std::fprintf(
+            out,
+            "%-48s %14zu %14.2f %14.3f\n",
+            r.name.c_str(),
+            r.iterations,
+            r.ns_per_iteration,
+            r.allocations_per_iteration
+        );
+    }
+    for (auto&& s : summaries) {
+        if (s.value.has_value()) {
+            std::fprintf(out, "%-48s %14g\n", s.name.c_str(), *s.value);
+        } else {
+            std::fprintf(out, "%-48s %14s\n", s.name.c_str(), "n/a");
+        }
+    }
+}
+
+void report_json(std::FILE* out, const std::vector<result>& results, const std::vector<summary>& summaries)
+{
+    std::fprintf(out, "{\n");
+    std::fprintf(out, "  \"context\": {\n");
+    std::fprintf(out, "    \"mica_version\": %s,\n", json_string(MICA_BENCH_VERSION).c_str());
+    std::fprintf(out, "    \"compiler\": %s\n", json_string(__VERSION__).c_str());
+    std::fprintf(out, "  },\n");
+    std::fprintf(out, "  \"benchmarks\": [");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        auto&& r = results[i];
+        std::fprintf(
+            out,
+            "%s\n    {\"name\": %s, \"iterations\": %zu, \"ns_per_iteration\": %.3f, "
+            "\"allocations_per_iteration\": %.6f}",
+            i == 0 ? "" : ",",
+            json_string(r.name).c_str(),
+            r.iterations,
+            r.ns_per_iteration,
+            r.allocations_per_iteration
+        );
+    }
+    std::fprintf(out, "\n  ],\n");
+    std::fprintf(out, "  \"summaries\": [");
+    for (std::size_t i = 0; i < summaries.size(); ++i) {
+        auto&& s = summaries[i];
+        std::fprintf(out, "%s\n    {\"name\": %s, \"value\": ", i == 0 ? "" : ",", json_string(s.name).c_str());
+        if (s.value.has_value()) {
+            std::fprintf(out, "%.6g}", *s.value);
+        } else {
+            std::fprintf(out, "null}");
+        }
+    }
+    std::fprintf(out, "\n  ]\n");
+    std::fprintf(out, "}\n");
+}
+
+} // namespace mica_bench
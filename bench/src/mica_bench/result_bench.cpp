@@ -0,0 +1,92 @@
+#include <mica_bench/bench.hpp>
+
+#include <cstddef>
+#include <expected>
+#include <mica/mica.hpp>
+#include <optional>
+#include <vector>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr std::size_t FRAME_PROBE_CALLS = 1024;
+
+[[gnu::noinline]] std::expected<int, mica::error> check(int value) noexcept
+{
+    if (value < 0) {
+        return std::unexpected(mica::errc::invalid_argument);
+    }
+    return value + 1;
+}
+
+[[gnu::noinline]] std::expected<int, mica::error> macro_sum(int value) noexcept
+{
+    int first = 0;
+    int second = 0;
+    int third = 0;
+    MICA_TRY(first, check(value));
+    MICA_TRY(second, check(first));
+    MICA_TRY(third, check(second));
+    return first + second + third;
+}
+
+[[gnu::noinline]] std::expected<int, mica::error> expr_sum(int value) noexcept
+{
+    int first = MICA_TRY_EXPR(check(value));
+    int second = MICA_TRY_EXPR(check(first));
+    int third = MICA_TRY_EXPR(check(second));
+    return first + second + third;
+}
+
+mica::result<int, mica::error> coroutine_sum(int value)
+{
+    int first = co_await check(value);
+    int second = co_await check(first);
+    int third = co_await check(second);
+    co_return first + second + third;
+}
+
+// The result is consumed right away, the shape that allows elision
+[[gnu::noinline]] std::expected<int, mica::error> result_sum(int value) noexcept
+{
+    return coroutine_sum(value);
+}
+
+template<auto Func, int Value>
+void sum_bench(state& s)
+{
+    int value = Value;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        do_not_optimize(Func(value));
+    }
+}
+
+// Frames allocated per call of result_sum: 0 when the compiler elided the
+// allocation, 1 when the frame came from the frame pool. Heap allocations
+// are reported by the result benchmarks themselves.
+std::optional<double> result_frames_per_call(const std::vector<result>& results)
+{
+    if (find(results, "result/result/success") == nullptr) {
+        return std::nullopt;
+    }
+    const std::size_t before = mica::allocated_frames();
+    for (std::size_t i = 0; i < FRAME_PROBE_CALLS; ++i) {
+        do_not_optimize(result_sum(static_cast<int>(i)));
+    }
+    return static_cast<double>(mica::allocated_frames() - before) / FRAME_PROBE_CALLS;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("result/try/success", (sum_bench<macro_sum, 1>));
+MICA_BENCH("result/try/failure", (sum_bench<macro_sum, -1>));
+MICA_BENCH("result/try_expr/success", (sum_bench<expr_sum, 1>));
+MICA_BENCH("result/try_expr/failure", (sum_bench<expr_sum, -1>));
+MICA_BENCH("result/result/success", (sum_bench<result_sum, 1>));
+MICA_BENCH("result/result/failure", (sum_bench<result_sum, -1>));
+
+MICA_BENCH_SUMMARY("result/frames_per_call", result_frames_per_call);
+
+} // namespace mica_bench
@@ -0,0 +1,70 @@
+#include <mica_bench/bench.hpp>
+
+#include <mica/mica.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mica_bench {
+
+namespace {
+
+// Messages that quote the rejected input can be kilobytes long
+const std::string LONG_MESSAGE = "invalid request body: " + std::string(4096, 'x');
+
+[[gnu::noinline]] int checked_port(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument(LONG_MESSAGE);
+    }
+    return value;
+}
+
+// Messages of std::stoi and the like fit the small string buffer
+[[gnu::noinline]] int checked_short(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument("stoi");
+    }
+    return value;
+}
+
+template<typename Policy, auto Func = checked_port>
+void failure(state& s)
+{
+    int value = -1;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        auto&& exp = mica::make_noexcept<Func, Policy>(value);
+        do_not_optimize(exp);
+    }
+}
+
+template<typename Sampler>
+using sampled_string = mica::sampled<std::string, MICA_CALL_SITE, Sampler>;
+
+// Time per failure of full capture divided by the time of one_in<100>
+std::optional<double> one_in_speedup(const std::vector<result>& results)
+{
+    const result* full = find(results, "sampling/full/string");
+    const result* sampled = find(results, "sampling/one_in_100/string");
+    if (full == nullptr || sampled == nullptr || sampled->ns_per_iteration <= 0) {
+        return std::nullopt;
+    }
+    return full->ns_per_iteration / sampled->ns_per_iteration;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("sampling/full/string", failure<std::string>);
+MICA_BENCH("sampling/one_in_100/string", (failure<sampled_string<mica::one_in<100>>>));
+MICA_BENCH("sampling/rate_limited_1000/string", (failure<sampled_string<mica::rate_limited<1000>>>));
+MICA_BENCH("sampling/full/string_short", (failure<std::string, checked_short>));
+MICA_BENCH("sampling/one_in_100/string_short", (failure<sampled_string<mica::one_in<100>>, checked_short>));
+MICA_BENCH("sampling/full/error", failure<mica::error>);
+MICA_BENCH("sampling/one_in_100/error", (failure<mica::sampled<mica::error, MICA_CALL_SITE, mica::one_in<100>>>));
+
+MICA_BENCH_SUMMARY("sampling/one_in_100_speedup", one_in_speedup);
+
+} // namespace mica_bench
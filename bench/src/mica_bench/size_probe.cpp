@@ -0,0 +1,60 @@
+// Compiled into several objects by the mica_bench_size target to measure the
+// code size of a make_noexcept instantiation. MICA_BENCH_SIZE_COUNT distinct
+// functions are wrapped; with MICA_BENCH_SIZE_INLINE_HANDLERS the wrappers
+// build their errors inside their own catch blocks, the way make_noexcept
+// did before the error construction was outlined.
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <expected>
+#include <mica/mica.hpp>
+#include <string>
+#include <utility>
+
+#ifndef MICA_BENCH_SIZE_COUNT
+#define MICA_BENCH_SIZE_COUNT 0
+#endif
+
+#ifndef MICA_BENCH_SIZE_INLINE_HANDLERS
+#define MICA_BENCH_SIZE_INLINE_HANDLERS 0
+#endif
+
+namespace mica_bench_size {
+
+using wrapper = std::expected<int, std::string> (*)(int) noexcept;
+
+// Only declared, each one is a distinct function that may throw
+template<std::size_t I>
+int wrapped(int value);
+
+template<std::size_t I>
+std::expected<int, std::string> wrapper_instance(int value) noexcept
+{
+#if MICA_BENCH_SIZE_INLINE_HANDLERS
+    using traits = mica::error_traits<std::string>;
+    try {
+        return wrapped<I>(value);
+    } catch (const std::exception& e) {
+        return std::unexpected(traits::from_exception(e));
+    } catch (...) {
+        return std::unexpected(traits::from_unknown());
+    }
+#else
+    return mica::make_noexcept<wrapped<I>>(value);
+#endif
+}
+
+template<std::size_t... I>
+constexpr std::array<wrapper, sizeof...(I)> make_wrappers(std::index_sequence<I...>) noexcept
+{
+    return {&wrapper_instance<I>...};
+}
+
+// Referencing every instance keeps them in the object
+extern const std::array<wrapper, MICA_BENCH_SIZE_COUNT> wrappers;
+
+const std::array<wrapper, MICA_BENCH_SIZE_COUNT> wrappers =
+    make_wrappers(std::make_index_sequence<MICA_BENCH_SIZE_COUNT>());
+
+} // namespace mica_bench_size
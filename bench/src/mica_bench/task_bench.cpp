@@ -0,0 +1,103 @@
+#include <mica_bench/bench.hpp>
+
+#include <expected>
+#include <future>
+#include <mica/mica.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr int CHAIN_DEPTH = 8;
+
+[[gnu::noinline]] int check(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument("negative");
+    }
+    return value + 1;
+}
+
+[[gnu::noinline]] std::expected<int, std::string> check_expected(int value)
+{
+    if (value < 0) {
+        return std::unexpected("negative");
+    }
+    return value + 1;
+}
+
+// Deferred futures run on get(), like an awaited lazy task, so both chains
+// measure call overhead rather than thread hand-off
+int future_chain(int depth, int value)
+{
+    if (depth == 0) {
+        return check(value);
+    }
+    auto child = std::async(std::launch::deferred, future_chain, depth - 1, value);
+    return child.get() + 1;
+}
+
+mica::task<std::expected<int, std::string>> task_chain(int depth, int value)
+{
+    if (depth == 0) {
+        co_return check_expected(value);
+    }
+    int child = co_await task_chain(depth - 1, value);
+    co_return child + 1;
+}
+
+template<int Value>
+void future_bench(state& s)
+{
+    for (auto _ : s) {
+        try {
+            do_not_optimize(future_chain(CHAIN_DEPTH, Value));
+        } catch (const std::exception& e) {
+            do_not_optimize(e);
+        }
+    }
+}
+
+template<int Value>
+void task_bench(state& s)
+{
+    for (auto _ : s) {
+        do_not_optimize(mica::sync_wait(task_chain(CHAIN_DEPTH, Value)));
+    }
+}
+
+template<int Value>
+void run_loop_bench(state& s)
+{
+    mica::run_loop loop;
+    for (auto _ : s) {
+        do_not_optimize(loop.run(task_chain(CHAIN_DEPTH, Value)));
+    }
+}
+
+// Time of a std::future chain over a task chain of the same depth
+std::optional<double> task_speedup(const std::vector<result>& results)
+{
+    auto* future = find(results, "task/future/success");
+    auto* task = find(results, "task/task/success");
+    if (future == nullptr || task == nullptr) {
+        return std::nullopt;
+    }
+    return future->ns_per_iteration / task->ns_per_iteration;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("task/future/success", future_bench<1>);
+MICA_BENCH("task/future/failure", future_bench<-1>);
+MICA_BENCH("task/task/success", task_bench<1>);
+MICA_BENCH("task/task/failure", task_bench<-1>);
+MICA_BENCH("task/run_loop/success", run_loop_bench<1>);
+
+MICA_BENCH_SUMMARY("task/speedup", task_speedup);
+
+} // namespace mica_bench
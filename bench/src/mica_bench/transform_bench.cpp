@@ -0,0 +1,94 @@
+#include <mica_bench/bench.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <mica/mica.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mica_bench {
+
+namespace {
+
+constexpr std::size_t BATCH_SIZE = 4096;
+
+// One in 1000 records fails
+constexpr int FAILURE_PERIOD = 1000;
+
+[[gnu::noinline]] int parse_record(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument("negative record");
+    }
+    return value * 2;
+}
+
+std::vector<int> make_batch()
+{
+    std::vector<int> batch(BATCH_SIZE);
+    for (std::size_t i = 0; i < BATCH_SIZE; ++i) {
+        batch[i] = i % FAILURE_PERIOD == FAILURE_PERIOD - 1 ? -1 : static_cast<int>(i);
+    }
+    return batch;
+}
+
+std::vector<std::expected<int, std::string>> per_element(const std::vector<int>& batch)
+{
+    std::vector<std::expected<int, std::string>> output;
+    output.reserve(batch.size());
+    for (int record : batch) {
+        output.push_back(mica::make_noexcept<parse_record>(record));
+    }
+    return output;
+}
+
+void per_element_batch(state& s)
+{
+    const std::vector<int> batch = make_batch();
+    for (auto _ : s) {
+        do_not_optimize(per_element(batch));
+    }
+}
+
+void columnar_batch(state& s)
+{
+    const std::vector<int> batch = make_batch();
+    mica::columnar_result<int> output;
+    for (auto _ : s) {
+        output.clear();
+        do_not_optimize(mica::transform_noexcept<parse_record>(batch, output));
+        do_not_optimize(output.values().data());
+    }
+}
+
+// Bytes of result storage per record
+std::optional<double> per_element_bytes(const std::vector<result>&)
+{
+    const auto output = per_element(make_batch());
+    return static_cast<double>(output.size() * sizeof(output[0])) / BATCH_SIZE;
+}
+
+std::optional<double> columnar_bytes(const std::vector<result>&)
+{
+    mica::columnar_result<int> output;
+    if (!mica::transform_noexcept<parse_record>(make_batch(), output).has_value()) {
+        return std::nullopt;
+    }
+    const std::size_t bytes = output.values().size_bytes()
+        + (output.size() + 63) / 64 * sizeof(std::uint64_t)
+        + output.errors().size_bytes();
+    return static_cast<double>(bytes) / BATCH_SIZE;
+}
+
+} // unnamed namespace
+
+MICA_BENCH("transform/per_element", per_element_batch);
+MICA_BENCH("transform/columnar", columnar_batch);
+
+MICA_BENCH_SUMMARY("transform/per_element/bytes_per_record", per_element_bytes);
+MICA_BENCH_SUMMARY("transform/columnar/bytes_per_record", columnar_bytes);
+
+} // namespace mica_bench
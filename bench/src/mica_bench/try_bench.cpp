@@ -0,0 +1,240 @@
+#include <mica_bench/bench.hpp>
+#include <mica_bench/chains.hpp>
+
+#include <array>
+#include <cstddef>
+#include <expected>
+#include <mica/mica.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace mica_bench {
+
+namespace {
+
+template<int Depth>
+void expected_success(state& s)
+{
+    int value = 0;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        do_not_optimize(expected_chain<Depth>(value));
+    }
+}
+
+template<int Depth>
+void exception_success(state& s)
+{
+    int value = 0;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        try {
+            do_not_optimize(exception_chain<Depth>(value));
+        } catch (const std::exception& e) {
+            do_not_optimize(e.what());
+        }
+    }
+}
+
+template<int Depth>
+void expected_failure(state& s)
+{
+    int value = -1;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        do_not_optimize(expected_chain<Depth>(value));
+    }
+}
+
+template<int Depth>
+void exception_failure(state& s)
+{
+    int value = -1;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        try {
+            do_not_optimize(exception_chain<Depth>(value));
+        } catch (const std::exception& e) {
+            do_not_optimize(e.what());
+        }
+    }
+}
+
+template<int Depth>
+[[gnu::noinline]] std::expected<int, mica::with_context<mica::error>> context_chain(int value) noexcept
+{
+    if constexpr (Depth == 0) {
+        if (value < 0) {
+            return std::unexpected(mica::errc::invalid_argument);
+        }
+        return value;
+    } else {
+        int output = 0;
+        MICA_TRY_CONTEXT(output, context_chain<Depth - 1>(value), "propagating value");
+        return output + 1;
+    }
+}
+
+// Context added by formatting a new message at every level
+template<int Depth>
+[[gnu::noinline]] std::expected<int, std::string> string_context_chain(int value) noexcept
+{
+    if constexpr (Depth == 0) {
+        if (value < 0) {
+            return std::unexpected(std::string("invalid argument"));
+        }
+        return value;
+    } else {
+        auto&& exp = string_context_chain<Depth - 1>(value);
+        if (!exp.has_value()) [[unlikely]] {
+            return std::unexpected("propagating value: " + std::move(exp).error());
+        }
+        return *exp + 1;
+    }
+}
+
+template<int Depth>
+void context_failure(state& s)
+{
+    int value = -1;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        do_not_optimize(context_chain<Depth>(value));
+    }
+}
+
+template<int Depth>
+void string_context_failure(state& s)
+{
+    int value = -1;
+    do_not_optimize(value);
+    for (auto _ : s) {
+        do_not_optimize(string_context_chain<Depth>(value));
+    }
+}
+
+// Large value type counting its default constructions, moves and move
+// assignments
+struct payload {
+    payload() noexcept
+    {
+        ++operations;
+    }
+
+    explicit payload(int seed) noexcept
+    {
+        bytes.fill(static_cast<std::byte>(seed));
+    }
+
+    payload(const payload&) = default;
+
+    payload(payload&& other) noexcept
+        : bytes(other.bytes)
+    {
+        ++operations;
+    }
+
+    payload& operator=(const payload&) = default;
+
+    payload& operator=(payload&& other) noexcept
+    {
+        bytes = other.bytes;
+        ++operations;
+        return *this;
+    }
+
+    std::array<std::byte, 512> bytes{};
+
+    static inline std::size_t operations = 0;
+};
+
+[[gnu::noinline]] std::expected<payload, mica::error> make_payload(int seed) noexcept
+{
+    if (seed < 0) {
+        return std::unexpected(mica::errc::invalid_argument);
+    }
+    return std::expected<payload, mica::error>(std::in_place, seed);
+}
+
+[[gnu::noinline]] std::expected<std::byte, mica::error> try_assign(int seed) noexcept
+{
+    payload value;
+    MICA_TRY(value, make_payload(seed));
+    return value.bytes[0];
+}
+
+[[gnu::noinline]] std::expected<std::byte, mica::error> try_expr(int seed) noexcept
+{
+    auto value = MICA_TRY_EXPR(make_payload(seed));
+    return value.bytes[0];
+}
+
+[[gnu::noinline]] std::expected<std::byte, mica::error> try_decl(int seed) noexcept
+{
+    MICA_TRY_DECL(payload value, make_payload(seed));
+    return value.bytes[0];
+}
+
+[[gnu::noinline]] std::expected<std::byte, mica::error> try_decl_reference(int seed) noexcept
+{
+    MICA_TRY_DECL(auto&& value, make_payload(seed));
+    return value.bytes[0];
+}
+
+using payload_function = std::expected<std::byte, mica::error> (*)(int) noexcept;
+
+template<payload_function Function>
+void large_value(state& s)
+{
+    int seed = 1;
+    do_not_optimize(seed);
+    for (auto _ : s) {
+        do_not_optimize(Function(seed));
+    }
+}
+
+// Constructions and moves of the large value per successful call, besides
+// the construction in make_payload
+template<payload_function Function>
+std::optional<double> operations_per_call(const std::vector<result>&)
+{
+    payload::operations = 0;
+    do_not_optimize(Function(1));
+    return static_cast<double>(payload::operations);
+}
+
+} // unnamed namespace
+
+MICA_BENCH("try/success/expected/depth=1", expected_success<1>);
+MICA_BENCH("try/success/expected/depth=4", expected_success<4>);
+MICA_BENCH("try/success/expected/depth=16", expected_success<16>);
+MICA_BENCH("try/success/expected/depth=64", expected_success<64>);
+MICA_BENCH("try/success/exception/depth=1", exception_success<1>);
+MICA_BENCH("try/success/exception/depth=4", exception_success<4>);
+MICA_BENCH("try/success/exception/depth=16", exception_success<16>);
+MICA_BENCH("try/success/exception/depth=64", exception_success<64>);
+
+MICA_BENCH("try/failure/expected/depth=1", expected_failure<1>);
+MICA_BENCH("try/failure/expected/depth=4", expected_failure<4>);
+MICA_BENCH("try/failure/expected/depth=16", expected_failure<16>);
+MICA_BENCH("try/failure/expected/depth=64", expected_failure<64>);
+MICA_BENCH("try/failure/exception/depth=1", exception_failure<1>);
+MICA_BENCH("try/failure/exception/depth=4", exception_failure<4>);
+MICA_BENCH("try/failure/exception/depth=16", exception_failure<16>);
+MICA_BENCH("try/failure/exception/depth=64", exception_failure<64>);
+
+MICA_BENCH("try/context/with_context/depth=8", context_failure<8>);
+MICA_BENCH("try/context/string/depth=8", string_context_failure<8>);
+
+MICA_BENCH("try/large_value/try", large_value<try_assign>);
+MICA_BENCH("try/large_value/try_expr", large_value<try_expr>);
+MICA_BENCH("try/large_value/try_decl", large_value<try_decl>);
+MICA_BENCH("try/large_value/try_decl_reference", large_value<try_decl_reference>);
+
+MICA_BENCH_SUMMARY("try/large_value/try/operations", operations_per_call<try_assign>);
+MICA_BENCH_SUMMARY("try/large_value/try_expr/operations", operations_per_call<try_expr>);
+MICA_BENCH_SUMMARY("try/large_value/try_decl/operations", operations_per_call<try_decl>);
+MICA_BENCH_SUMMARY("try/large_value/try_decl_reference/operations", operations_per_call<try_decl_reference>);
+
+} // namespace mica_bench
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <any>
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mica/type_traits.hpp>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Detection of the throwing std accessors replaced by checked.hpp, which
+// includes it. Names the std class templates, so make_noexcept only sees it
+// through internal::throwing_accessor and does not include it.
+
+namespace mica {
+
+namespace internal {
+
+// True when Func is a throwing std accessor replaced by the ones of
+// checked.hpp, so make_noexcept can point to them. Lambdas calling the
+// accessors are not recognized.
+template<auto Func>
+constexpr bool is_checked_accessor() noexcept;
+
+template<auto Func>
+struct throwing_accessor<Func, std::enable_if_t<is_checked_accessor<Func>()>> : std::true_type
+{};
+
+} // namespace mica::internal
+
+} // namespace mica
+
+#include <mica/accessor_traits.inl>
@@ -0,0 +1,146 @@
+namespace mica {
+
+namespace internal {
+
+template<typename T>
+struct is_checked_class : std::false_type
+{};
+
+template<typename T, typename Allocator>
+struct is_checked_class<std::vector<T, Allocator>> : std::true_type
+{};
+
+template<typename T, typename Allocator>
+struct is_checked_class<std::deque<T, Allocator>> : std::true_type
+{};
+
+template<typename CharT, typename Traits, typename Allocator>
+struct is_checked_class<std::basic_string<CharT, Traits, Allocator>> : std::true_type
+{};
+
+template<typename T, std::size_t N>
+struct is_checked_class<std::array<T, N>> : std::true_type
+{};
+
+template<typename Key, typename T, typename Compare, typename Allocator>
+struct is_checked_class<std::map<Key, T, Compare, Allocator>> : std::true_type
+{};
+
+template<typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+struct is_checked_class<std::unordered_map<Key, T, Hash, Equal, Allocator>> : std::true_type
+{};
+
+template<typename T>
+struct is_checked_class<std::optional<T>> : std::true_type
+{};
+
+template<typename F>
+struct member_class
+{};
+
+template<typename R, typename C>
+struct member_class<R C::*>
+{
+    using type = C;
+};
+
+template<typename F>
+struct single_parameter
+{};
+
+template<typename R, typename A>
+struct single_parameter<R (*)(A)>
+{
+    using result = R;
+    using type = std::remove_cvref_t<A>;
+};
+
+template<typename T>
+struct is_variant : std::false_type
+{};
+
+template<typename... Ts>
+struct is_variant<std::variant<Ts...>> : std::true_type
+{};
+
+// at of a container or value of an optional
+template<auto Func>
+constexpr bool is_checked_member() noexcept
+{
+    using F = decltype(Func);
+    using C = typename member_class<F>::type;
+    if constexpr (is_checked_class<C>::value) {
+        if constexpr (requires { static_cast<F>(&C::at); }) {
+            if (static_cast<F>(&C::at) == Func) {
+                return true;
+            }
+        }
+        if constexpr (requires { static_cast<F>(&C::value); }) {
+            if (static_cast<F>(&C::value) == Func) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template<auto Func, std::size_t I>
+constexpr bool is_get_index() noexcept
+{
+    using F = decltype(Func);
+    if constexpr (requires { static_cast<F>(&std::get<I>); }) {
+        return static_cast<F>(&std::get<I>) == Func;
+    }
+    return false;
+}
+
+// std::get<T> of a variant holding T more than once does not compile
+template<auto Func, typename T, typename... Ts>
+constexpr bool is_get_type() noexcept
+{
+    using F = decltype(Func);
+    if constexpr ((std::is_same_v<T, Ts> + ...) == 1) {
+        if constexpr (requires { static_cast<F>(&std::get<T>); }) {
+            return static_cast<F>(&std::get<T>) == Func;
+        }
+    }
+    return false;
+}
+
+template<auto Func, typename... Ts, std::size_t... I>
+constexpr bool is_variant_get(std::type_identity<std::variant<Ts...>>, std::index_sequence<I...>) noexcept
+{
+    return (is_get_index<Func, I>() || ...) || (is_get_type<Func, Ts, Ts...>() || ...);
+}
+
+template<auto Func>
+constexpr bool is_checked_free_function() noexcept
+{
+    using F = decltype(Func);
+    using A = typename single_parameter<F>::type;
+    if constexpr (is_variant<A>::value) {
+        return is_variant_get<Func>(std::type_identity<A>(), std::make_index_sequence<std::variant_size_v<A>>());
+    } else if constexpr (std::is_same_v<A, std::any>) {
+        using R = typename single_parameter<F>::result;
+        if constexpr (requires { static_cast<F>(&std::any_cast<R>); }) {
+            return static_cast<F>(&std::any_cast<R>) == Func;
+        }
+    }
+    return false;
+}
+
+template<auto Func>
+constexpr bool is_checked_accessor() noexcept
+{
+    using F = decltype(Func);
+    if constexpr (std::is_member_function_pointer_v<F>) {
+        return is_checked_member<Func>();
+    } else if constexpr (requires { typename single_parameter<F>::type; }) {
+        return is_checked_free_function<Func>();
+    }
+    return false;
+}
+
+} // namespace mica::internal
+
+} // namespace mica
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <memory_resource>
+#include <mica/error_traits.hpp>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace mica {
+
+// Allocates raw memory without throwing, returning nullptr on failure
+template<typename A>
+concept try_allocator = std::move_constructible<A>
+    && requires(A& allocator, void* pointer, std::size_t size, std::size_t alignment) {
+        { allocator.allocate(size, alignment) } noexcept -> std::same_as<void*>;
+        { allocator.deallocate(pointer, size, alignment) } noexcept;
+    };
+
+// The global operator new and delete, nothrow
+struct heap_allocator
+{
+    void* allocate(std::size_t size, std::size_t alignment) noexcept;
+
+    void deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept;
+};
+
+// Sizes the emergency pools
+struct allocation_policy
+{
+    static constexpr std::size_t emergency_pool_size = 64 * 1024;
+
+    // Largest block an emergency pool serves. Larger blocks would be carved
+    // out of the reserved memory for good, so they are refused instead.
+    static constexpr std::size_t emergency_block_size = 4 * 1024;
+};
+
+// Memory reserved up front, so that out-of-memory handling can still
+// allocate, e.g. the error it reports. Freed blocks are reused for blocks of
+// the same size class, blocks larger than
+// allocation_policy::emergency_block_size are refused. Thread-safe.
+class emergency_pool {
+public:
+    // Reserves size bytes, throws std::bad_alloc if they are not available
+    explicit emergency_pool(std::size_t size);
+
+    // Reserves size bytes, or none if they are not available, every
+    // allocation then fails
+    emergency_pool(std::size_t size, std::nothrow_t) noexcept;
+
+    emergency_pool(const emergency_pool&) = delete;
+
+    emergency_pool& operator=(const emergency_pool&) = delete;
+
+    // Pool of allocation_policy::emergency_pool_size bytes, reserved during
+    // static initialization so it does not wait for memory to run out
+    static emergency_pool& global() noexcept;
+
+    void* allocate(std::size_t size, std::size_t alignment) noexcept;
+
+    void deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept;
+
+    bool owns(const void* pointer) const noexcept;
+
+private:
+    std::unique_ptr<std::byte[]> buffer_;
+    std::size_t size_;
+    std::mutex mutex_;
+    std::pmr::monotonic_buffer_resource reserved_;
+    // Empty when the reservation failed
+    std::optional<std::pmr::unsynchronized_pool_resource> pool_;
+};
+
+namespace internal {
+
+// Reserves the global pool at startup
+inline emergency_pool& global_emergency_pool = emergency_pool::global();
+
+} // namespace mica::internal
+
+// Allocates from Upstream, and from an emergency pool once Upstream fails
+template<try_allocator Upstream = heap_allocator>
+class emergency_allocator {
+public:
+    // Falls back to emergency_pool::global()
+    emergency_allocator() noexcept(std::is_nothrow_default_constructible_v<Upstream>);
+
+    explicit emergency_allocator(emergency_pool& pool, Upstream upstream = Upstream()) noexcept;
+
+    void* allocate(std::size_t size, std::size_t alignment) noexcept;
+
+    void deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept;
+
+private:
+    emergency_pool* pool_;
+    [[no_unique_address]] Upstream upstream_;
+};
+
+// Destroys and deallocates objects made by try_new
+template<typename T, try_allocator Allocator = heap_allocator>
+class allocator_delete {
+public:
+    allocator_delete() = default;
+
+    explicit allocator_delete(Allocator allocator) noexcept;
+
+    void operator()(T* pointer) noexcept;
+
+private:
+    [[no_unique_address]] Allocator allocator_;
+};
+
+template<typename T, try_allocator Allocator = heap_allocator>
+using try_ptr = std::unique_ptr<T, allocator_delete<T, Allocator>>;
+
+// Constructs a T, failing with errc::bad_alloc instead of throwing when no
+// memory is available. Exceptions thrown by the constructor of T propagate.
+template<typename T, error_type E = std::string, typename... Args>
+requires std::constructible_from<T, Args&&...>
+std::expected<try_ptr<T>, E> try_new(Args&&... args)
+    noexcept(std::is_nothrow_constructible_v<T, Args&&...>);
+
+template<typename T, error_type E = std::string, try_allocator Allocator, typename... Args>
+requires std::constructible_from<T, Args&&...>
+std::expected<try_ptr<T, Allocator>, E> try_new(std::allocator_arg_t, Allocator allocator, Args&&... args)
+    noexcept(std::is_nothrow_constructible_v<T, Args&&...>);
+
+} // namespace mica
+
+#include <mica/allocator.inl>
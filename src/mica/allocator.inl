@@ -0,0 +1,167 @@
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace mica {
+
+inline void* heap_allocator::allocate(std::size_t size, std::size_t alignment) noexcept
+{
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return ::operator new(size, std::align_val_t(alignment), std::nothrow);
+    }
+    return ::operator new(size, std::nothrow);
+}
+
+inline void heap_allocator::deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept
+{
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(pointer, size, std::align_val_t(alignment));
+    } else {
+        ::operator delete(pointer, size);
+    }
+}
+
+namespace internal {
+
+inline std::pmr::pool_options emergency_pool_options() noexcept
+{
+    std::pmr::pool_options options;
+    options.largest_required_pool_block = allocation_policy::emergency_block_size;
+    return options;
+}
+
+} // namespace mica::internal
+
+// The pool resource takes its bookkeeping from the reserved memory as well,
+// and fails with bad_alloc once the reserved memory is used up
+inline emergency_pool::emergency_pool(std::size_t size)
+    : buffer_(new std::byte[size]),
+      size_(size),
+      mutex_(),
+      reserved_(buffer_.get(), size_, std::pmr::null_memory_resource()),
+      pool_(std::in_place, internal::emergency_pool_options(), &reserved_)
+{}
+
+inline emergency_pool::emergency_pool(std::size_t size, std::nothrow_t) noexcept
+    : buffer_(new (std::nothrow) std::byte[size]),
+      size_(buffer_ != nullptr ? size : 0),
+      mutex_(),
+      reserved_(buffer_.get(), size_, std::pmr::null_memory_resource())
+{
+    try {
+        pool_.emplace(internal::emergency_pool_options(), &reserved_);
+    } catch (const std::bad_alloc&) {
+        size_ = 0;
+    }
+}
+
+inline emergency_pool& emergency_pool::global() noexcept
+{
+    static emergency_pool pool(allocation_policy::emergency_pool_size, std::nothrow);
+    return pool;
+}
+
+inline void* emergency_pool::allocate(std::size_t size, std::size_t alignment) noexcept
+{
+    // The pool resource takes larger blocks from the reserved memory and
+    // never gives them back
+    if (size > allocation_policy::emergency_block_size || !pool_.has_value()) {
+        return nullptr;
+    }
+    std::lock_guard lock(mutex_);
+    try {
+        return pool_->allocate(size, alignment);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+inline void emergency_pool::deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept
+{
+    std::lock_guard lock(mutex_);
+    pool_->deallocate(pointer, size, alignment);
+}
+
+inline bool emergency_pool::owns(const void* pointer) const noexcept
+{
+    const std::byte* begin = buffer_.get();
+    return !std::less<const void*>()(pointer, begin) && std::less<const void*>()(pointer, begin + size_);
+}
+
+template<try_allocator Upstream>
+emergency_allocator<Upstream>::emergency_allocator() noexcept(std::is_nothrow_default_constructible_v<Upstream>)
+    : pool_(&emergency_pool::global()),
+      upstream_()
+{}
+
+template<try_allocator Upstream>
+emergency_allocator<Upstream>::emergency_allocator(emergency_pool& pool, Upstream upstream) noexcept
+    : pool_(&pool),
+      upstream_(std::move(upstream))
+{}
+
+template<try_allocator Upstream>
+void* emergency_allocator<Upstream>::allocate(std::size_t size, std::size_t alignment) noexcept
+{
+    void* pointer = upstream_.allocate(size, alignment);
+    if (pointer == nullptr) [[unlikely]] {
+        return pool_->allocate(size, alignment);
+    }
+    return pointer;
+}
+
+template<try_allocator Upstream>
+void emergency_allocator<Upstream>::deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept
+{
+    if (pool_->owns(pointer)) [[unlikely]] {
+        pool_->deallocate(pointer, size, alignment);
+    } else {
+        upstream_.deallocate(pointer, size, alignment);
+    }
+}
+
+template<typename T, try_allocator Allocator>
+allocator_delete<T, Allocator>::allocator_delete(Allocator allocator) noexcept
+    : allocator_(std::move(allocator))
+{}
+
+template<typename T, try_allocator Allocator>
+void allocator_delete<T, Allocator>::operator()(T* pointer) noexcept
+{
+    pointer->~T();
+    allocator_.deallocate(pointer, sizeof(T), alignof(T));
+}
+
+template<typename T, error_type E, typename... Args>
+requires std::constructible_from<T, Args&&...>
+std::expected<try_ptr<T>, E> try_new(Args&&... args)
+    noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+{
+    return try_new<T, E>(std::allocator_arg, heap_allocator(), std::forward<Args>(args)...);
+}
+
+template<typename T, error_type E, try_allocator Allocator, typename... Args>
+requires std::constructible_from<T, Args&&...>
+std::expected<try_ptr<T, Allocator>, E> try_new(std::allocator_arg_t, Allocator allocator, Args&&... args)
+    noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+{
+    void* memory = allocator.allocate(sizeof(T), alignof(T));
+    if (memory == nullptr) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_alloc));
+    }
+    if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+        T* object = ::new (memory) T(std::forward<Args>(args)...);
+        return try_ptr<T, Allocator>(object, allocator_delete<T, Allocator>(std::move(allocator)));
+    } else {
+        T* object;
+        try {
+            object = ::new (memory) T(std::forward<Args>(args)...);
+        } catch (...) {
+            allocator.deallocate(memory, sizeof(T), alignof(T));
+            throw;
+        }
+        return try_ptr<T, Allocator>(object, allocator_delete<T, Allocator>(std::move(allocator)));
+    }
+}
+
+} // namespace mica
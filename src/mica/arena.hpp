@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <memory_resource>
+#include <mica/error_traits.hpp>
+#include <string>
+
+namespace mica {
+
+// Resource used for error and format strings on the calling thread. Defaults
+// to std::pmr::get_default_resource().
+std::pmr::memory_resource* current_resource() noexcept;
+
+// Installs resource as the current resource of the calling thread until
+// destroyed. Scopes must be destroyed in reverse order of construction.
+class scoped_resource {
+public:
+    explicit scoped_resource(std::pmr::memory_resource* resource) noexcept;
+
+    scoped_resource(const scoped_resource&) = delete;
+
+    scoped_resource& operator=(const scoped_resource&) = delete;
+
+    ~scoped_resource();
+
+private:
+    std::pmr::memory_resource* previous_;
+};
+
+// Installs a monotonic arena as the current resource of the calling thread.
+// Every allocation made through it is released at once when the arena is
+// destroyed, so strings allocated from it must not outlive the scope.
+class scoped_arena {
+public:
+    scoped_arena();
+
+    explicit scoped_arena(
+        std::size_t initial_size,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    );
+
+    scoped_arena(
+        void* buffer,
+        std::size_t buffer_size,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    );
+
+    scoped_arena(const scoped_arena&) = delete;
+
+    scoped_arena& operator=(const scoped_arena&) = delete;
+
+    std::pmr::memory_resource* resource() noexcept;
+
+private:
+    std::pmr::monotonic_buffer_resource arena_;
+    scoped_resource scope_;
+};
+
+// Error strings are allocated from current_resource()
+template<>
+struct error_traits<std::pmr::string>
+{
+    static std::pmr::string from_exception(const std::exception& e);
+
+    static std::pmr::string from_unknown();
+
+    static std::pmr::string from_code(errc code);
+
+    static std::pmr::string from_suppressed();
+
+    static std::pmr::string from_errno(int code);
+};
+
+} // namespace mica
+
+#include <mica/arena.inl>
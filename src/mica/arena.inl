@@ -0,0 +1,81 @@
+namespace mica {
+
+namespace internal {
+
+inline thread_local std::pmr::memory_resource* current_resource = nullptr;
+
+} // namespace mica::internal
+
+inline std::pmr::memory_resource* current_resource() noexcept
+{
+    std::pmr::memory_resource* resource = internal::current_resource;
+    if (resource == nullptr) {
+        return std::pmr::get_default_resource();
+    }
+    return resource;
+}
+
+inline scoped_resource::scoped_resource(std::pmr::memory_resource* resource) noexcept
+    : previous_(internal::current_resource)
+{
+    internal::current_resource = resource;
+}
+
+inline scoped_resource::~scoped_resource()
+{
+    internal::current_resource = previous_;
+}
+
+inline scoped_arena::scoped_arena()
+    : arena_(),
+      scope_(&arena_)
+{}
+
+inline scoped_arena::scoped_arena(std::size_t initial_size, std::pmr::memory_resource* upstream)
+    : arena_(initial_size, upstream),
+      scope_(&arena_)
+{}
+
+inline scoped_arena::scoped_arena(
+    void* buffer,
+    std::size_t buffer_size,
+    std::pmr::memory_resource* upstream
+)
+    : arena_(buffer, buffer_size, upstream),
+      scope_(&arena_)
+{}
+
+inline std::pmr::memory_resource* scoped_arena::resource() noexcept
+{
+    return &arena_;
+}
+
+inline std::pmr::string error_traits<std::pmr::string>::from_exception(const std::exception& e)
+{
+    return std::pmr::string(e.what(), current_resource());
+}
+
+inline std::pmr::string error_traits<std::pmr::string>::from_unknown()
+{
+    return std::pmr::string("unexpected error", current_resource());
+}
+
+inline std::pmr::string error_traits<std::pmr::string>::from_code(errc code)
+{
+    return std::pmr::string(to_string(code), current_resource());
+}
+
+inline std::pmr::string error_traits<std::pmr::string>::from_suppressed()
+{
+    return std::pmr::string(internal::short_suppressed_message, current_resource());
+}
+
+inline std::pmr::string error_traits<std::pmr::string>::from_errno(int code)
+{
+    if (const char* message = internal::errno_message(code)) {
+        return std::pmr::string(message, current_resource());
+    }
+    return std::pmr::string(std::generic_category().message(code), current_resource());
+}
+
+} // namespace mica
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mica/intern.hpp>
+#include <mica/macro.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mica {
+
+// Bounds the call sites known to the instrumentation policies. Sites
+// reached after max_sites others are not recorded.
+struct call_site_policy
+{
+    static constexpr std::size_t max_sites = 256;
+};
+
+namespace internal {
+
+// String literal usable as a template argument
+template<std::size_t N>
+struct fixed_string
+{
+    constexpr fixed_string(const char (&text)[N]) noexcept
+    {
+        std::copy_n(text, N, data);
+    }
+
+    constexpr std::string_view view() const noexcept
+    {
+        return std::string_view(data, N - 1);
+    }
+
+    char data[N]{};
+};
+
+constexpr std::uint64_t call_site_hash(std::string_view file, std::uint32_t line) noexcept
+{
+    std::uint64_t hash = intern_hash(file);
+    for (int shift = 0; shift < 32; shift += 8) {
+        hash ^= (line >> shift) & 0xff;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+} // namespace mica::internal
+
+// A source location known at compile time. Every file and line is a distinct
+// type whose id is a hash of both, spell it with MICA_CALL_SITE.
+template<internal::fixed_string File, std::uint32_t Line>
+struct call_site
+{
+    static constexpr std::string_view file = File.view();
+    static constexpr std::uint32_t line = Line;
+    static constexpr std::uint64_t id = internal::call_site_hash(file, line);
+};
+
+namespace internal {
+
+inline constexpr std::size_t no_site = call_site_policy::max_sites;
+
+struct site_info
+{
+    std::uint64_t id;
+    std::string_view file;
+    std::uint32_t line;
+};
+
+// Assigns the next free index to a call site on first use, no_site once
+// call_site_policy::max_sites sites are known. Indices are never reused.
+std::size_t register_site(std::uint64_t id, std::string_view file, std::uint32_t line) noexcept;
+
+template<typename Site>
+std::size_t site_index() noexcept;
+
+// Registered sites, ordered by index
+std::vector<site_info> registered_sites();
+
+// Appends "id":"<hex>","file":"<file>","line":<line>
+void append_site_json(std::string& output, const site_info& site);
+
+void append_json_string(std::string& output, std::string_view text);
+
+} // namespace mica::internal
+
+} // namespace mica
+
+#include <mica/call_site.inl>
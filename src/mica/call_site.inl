@@ -0,0 +1,104 @@
+#include <array>
+#include <cstdio>
+#include <mutex>
+
+namespace mica {
+
+namespace internal {
+
+class site_registry {
+public:
+    static site_registry& global() noexcept
+    {
+        static site_registry registry;
+        return registry;
+    }
+
+    std::size_t add(std::uint64_t id, std::string_view file, std::uint32_t line) noexcept
+    {
+        std::lock_guard lock(mutex_);
+        for (std::size_t index = 0; index < count_; ++index) {
+            if (sites_[index].id == id) {
+                return index;
+            }
+        }
+        if (count_ == call_site_policy::max_sites) {
+            return no_site;
+        }
+        sites_[count_] = site_info{id, file, line};
+        return count_++;
+    }
+
+    std::vector<site_info> sites()
+    {
+        std::lock_guard lock(mutex_);
+        return std::vector<site_info>(sites_.begin(), sites_.begin() + count_);
+    }
+
+private:
+    site_registry() = default;
+
+    std::mutex mutex_;
+    std::array<site_info, call_site_policy::max_sites> sites_{};
+    std::size_t count_ = 0;
+};
+
+inline std::size_t register_site(std::uint64_t id, std::string_view file, std::uint32_t line) noexcept
+{
+    return site_registry::global().add(id, file, line);
+}
+
+template<typename Site>
+std::size_t site_index() noexcept
+{
+    static const std::size_t index = register_site(Site::id, Site::file, Site::line);
+    return index;
+}
+
+inline std::vector<site_info> registered_sites()
+{
+    return site_registry::global().sites();
+}
+
+inline void append_site_json(std::string& output, const site_info& site)
+{
+    char id[19];
+    std::snprintf(id, sizeof(id), "%016llx", static_cast<unsigned long long>(site.id));
+    output += "\"id\":";
+    append_json_string(output, id);
+    output += ",\"file\":";
+    append_json_string(output, site.file);
+    output += ",\"line\":";
+    output += std::to_string(site.line);
+}
+
+inline void append_json_string(std::string& output, std::string_view text)
+{
+    output += '"';
+    for (char c : text) {
+        switch (c) {
+        case '"':
+            output += "\\\"";
+            break;
+        case '\\':
+            output += "\\\\";
+            break;
+        case '\n':
+            output += "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                output += escaped;
+            } else {
+                output += c;
+            }
+        }
+    }
+    output += '"';
+}
+
+} // namespace mica::internal
+
+} // namespace mica
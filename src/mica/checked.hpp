@@ -0,0 +1,90 @@
+#pragma once
+
+#include <any>
+#include <cstddef>
+#include <expected>
+#include <functional>
+#include <mica/accessor_traits.hpp>
+#include <mica/error_traits.hpp>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+// Accessors of std containers, optional, variant and any that check before
+// accessing instead of throwing. A miss costs a branch rather than a throw
+// and an unwind, and fails with errc::out_of_range, bad_optional_access,
+// bad_variant_access or bad_any_cast. The reference returned refers into
+// the argument, which must outlive it.
+
+namespace mica {
+
+namespace internal {
+
+template<typename Container>
+concept indexable = std::ranges::random_access_range<Container>
+    && std::ranges::sized_range<Container>
+    && std::is_lvalue_reference_v<std::ranges::range_reference_t<Container>>;
+
+template<typename Container, typename Key>
+concept keyed = requires(Container& container, const Key& key) {
+    typename Container::key_type;
+    typename Container::mapped_type;
+    { container.find(key) == container.end() } -> std::convertible_to<bool>;
+};
+
+template<typename Container, typename Key>
+using mapped_t = std::remove_reference_t<decltype((std::declval<Container&>().find(std::declval<const Key&>())->second))>;
+
+} // namespace mica::internal
+
+// Element index of a random access range, e.g. a vector, array or string
+template<typename E = std::string, internal::indexable Container>
+requires error_type<E>
+std::expected<std::reference_wrapper<std::remove_reference_t<std::ranges::range_reference_t<Container>>>, E>
+at(Container& container, std::size_t index) noexcept;
+
+// Value of key in a map or unordered map
+template<typename E = std::string, typename Container, typename Key>
+requires error_type<E> && internal::keyed<Container, Key> && (!internal::indexable<Container>)
+std::expected<std::reference_wrapper<internal::mapped_t<Container, Key>>, E>
+at(Container& container, const Key& key) noexcept;
+
+template<typename E = std::string, typename T>
+requires error_type<E>
+std::expected<std::reference_wrapper<T>, E> value(std::optional<T>& optional) noexcept;
+
+template<typename E = std::string, typename T>
+requires error_type<E>
+std::expected<std::reference_wrapper<const T>, E> value(const std::optional<T>& optional) noexcept;
+
+template<typename T, typename E = std::string, typename... Ts>
+requires error_type<E>
+std::expected<std::reference_wrapper<T>, E> get(std::variant<Ts...>& variant) noexcept;
+
+template<typename T, typename E = std::string, typename... Ts>
+requires error_type<E>
+std::expected<std::reference_wrapper<const T>, E> get(const std::variant<Ts...>& variant) noexcept;
+
+template<std::size_t I, typename E = std::string, typename... Ts>
+requires error_type<E> && (I < sizeof...(Ts))
+std::expected<std::reference_wrapper<std::variant_alternative_t<I, std::variant<Ts...>>>, E>
+get(std::variant<Ts...>& variant) noexcept;
+
+template<std::size_t I, typename E = std::string, typename... Ts>
+requires error_type<E> && (I < sizeof...(Ts))
+std::expected<std::reference_wrapper<const std::variant_alternative_t<I, std::variant<Ts...>>>, E>
+get(const std::variant<Ts...>& variant) noexcept;
+
+template<typename T, typename E = std::string>
+requires error_type<E> && std::same_as<T, std::remove_cvref_t<T>>
+std::expected<std::reference_wrapper<T>, E> any_cast(std::any& any) noexcept;
+
+template<typename T, typename E = std::string>
+requires error_type<E> && std::same_as<T, std::remove_cvref_t<T>>
+std::expected<std::reference_wrapper<const T>, E> any_cast(const std::any& any) noexcept;
+
+} // namespace mica
+
+#include <mica/checked.inl>
@@ -0,0 +1,117 @@
+#include <memory>
+#include <utility>
+
+namespace mica {
+
+template<typename E, internal::indexable Container>
+requires error_type<E>
+std::expected<std::reference_wrapper<std::remove_reference_t<std::ranges::range_reference_t<Container>>>, E>
+at(Container& container, std::size_t index) noexcept
+{
+    if (index >= static_cast<std::size_t>(std::ranges::size(container))) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::out_of_range));
+    }
+    return std::ref(std::ranges::begin(container)[static_cast<std::ranges::range_difference_t<Container>>(index)]);
+}
+
+template<typename E, typename Container, typename Key>
+requires error_type<E> && internal::keyed<Container, Key> && (!internal::indexable<Container>)
+std::expected<std::reference_wrapper<internal::mapped_t<Container, Key>>, E>
+at(Container& container, const Key& key) noexcept
+{
+    auto it = container.find(key);
+    if (it == container.end()) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::out_of_range));
+    }
+    return std::ref(it->second);
+}
+
+template<typename E, typename T>
+requires error_type<E>
+std::expected<std::reference_wrapper<T>, E> value(std::optional<T>& optional) noexcept
+{
+    if (!optional.has_value()) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_optional_access));
+    }
+    return std::ref(*optional);
+}
+
+template<typename E, typename T>
+requires error_type<E>
+std::expected<std::reference_wrapper<const T>, E> value(const std::optional<T>& optional) noexcept
+{
+    if (!optional.has_value()) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_optional_access));
+    }
+    return std::cref(*optional);
+}
+
+template<typename T, typename E, typename... Ts>
+requires error_type<E>
+std::expected<std::reference_wrapper<T>, E> get(std::variant<Ts...>& variant) noexcept
+{
+    T* alternative = std::get_if<T>(&variant);
+    if (alternative == nullptr) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_variant_access));
+    }
+    return std::ref(*alternative);
+}
+
+template<typename T, typename E, typename... Ts>
+requires error_type<E>
+std::expected<std::reference_wrapper<const T>, E> get(const std::variant<Ts...>& variant) noexcept
+{
+    const T* alternative = std::get_if<T>(&variant);
+    if (alternative == nullptr) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_variant_access));
+    }
+    return std::cref(*alternative);
+}
+
+template<std::size_t I, typename E, typename... Ts>
+requires error_type<E> && (I < sizeof...(Ts))
+std::expected<std::reference_wrapper<std::variant_alternative_t<I, std::variant<Ts...>>>, E>
+get(std::variant<Ts...>& variant) noexcept
+{
+    auto* alternative = std::get_if<I>(&variant);
+    if (alternative == nullptr) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_variant_access));
+    }
+    return std::ref(*alternative);
+}
+
+template<std::size_t I, typename E, typename... Ts>
+requires error_type<E> && (I < sizeof...(Ts))
+std::expected<std::reference_wrapper<const std::variant_alternative_t<I, std::variant<Ts...>>>, E>
+get(const std::variant<Ts...>& variant) noexcept
+{
+    const auto* alternative = std::get_if<I>(&variant);
+    if (alternative == nullptr) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_variant_access));
+    }
+    return std::cref(*alternative);
+}
+
+template<typename T, typename E>
+requires error_type<E> && std::same_as<T, std::remove_cvref_t<T>>
+std::expected<std::reference_wrapper<T>, E> any_cast(std::any& any) noexcept
+{
+    T* value = std::any_cast<T>(&any);
+    if (value == nullptr) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_any_cast));
+    }
+    return std::ref(*value);
+}
+
+template<typename T, typename E>
+requires error_type<E> && std::same_as<T, std::remove_cvref_t<T>>
+std::expected<std::reference_wrapper<const T>, E> any_cast(const std::any& any) noexcept
+{
+    const T* value = std::any_cast<T>(&any);
+    if (value == nullptr) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_any_cast));
+    }
+    return std::cref(*value);
+}
+
+} // namespace mica
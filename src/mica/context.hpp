@@ -0,0 +1,168 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <expected>
+#include <mica/error_traits.hpp>
+#include <source_location>
+#include <string>
+#include <type_traits>
+
+namespace mica {
+
+// Where an error passed through and what was being done there. The message
+// is never owned, it must be a string literal or outlive the error.
+struct context_frame
+{
+    const char* message;
+    std::source_location location;
+};
+
+namespace internal {
+
+inline constexpr std::size_t context_capacity = 8;
+
+} // namespace mica::internal
+
+// Context frames of an error, most recent first. A view of the frames stored
+// in a with_context, it must not outlive the error. truncated() is set when
+// the error held more frames than it could store.
+class context_chain {
+public:
+    class sentinel {};
+
+    class iterator {
+    public:
+        constexpr iterator(const context_frame* frames, std::size_t remaining) noexcept;
+
+        constexpr const context_frame& operator*() const noexcept;
+
+        constexpr const context_frame* operator->() const noexcept;
+
+        constexpr iterator& operator++() noexcept;
+
+        constexpr bool operator!=(sentinel) const noexcept;
+
+    private:
+        const context_frame* frames_;
+        std::size_t remaining_;
+    };
+
+    constexpr context_chain() noexcept = default;
+
+    constexpr context_chain(const context_frame* frames, std::size_t size, bool truncated) noexcept;
+
+    constexpr iterator begin() const noexcept;
+
+    constexpr sentinel end() const noexcept;
+
+    constexpr bool empty() const noexcept;
+
+    constexpr std::size_t size() const noexcept;
+
+    constexpr bool truncated() const noexcept;
+
+private:
+    const context_frame* frames_ = nullptr;
+    std::size_t size_ = 0;
+    bool truncated_ = false;
+};
+
+// One frame per line, "message (file:line, function)". Only allocates here,
+// when the context is read.
+std::string to_string(const context_chain& chain);
+
+// Error of type E with a chain of context frames. The frames are stored in
+// the error itself, adding one stores two pointers and never allocates. The
+// first capacity frames are kept, the ones closest to where the error came
+// from; frames added after that are dropped and mark the chain truncated.
+template<typename E>
+class with_context {
+public:
+    static constexpr std::size_t capacity = internal::context_capacity;
+
+    constexpr with_context() = default;
+
+    template<typename G>
+    requires std::constructible_from<E, G&&> && (!std::same_as<std::remove_cvref_t<G>, with_context>)
+    constexpr with_context(G&& error) noexcept(std::is_nothrow_constructible_v<E, G&&>);
+
+    constexpr const E& error() const& noexcept;
+
+    constexpr E&& error() && noexcept;
+
+    constexpr context_chain context() const noexcept;
+
+    constexpr with_context& add_context(
+        const char* message,
+        std::source_location location = std::source_location::current()
+    ) noexcept;
+
+private:
+    E error_{};
+    std::array<context_frame, capacity> frames_{};
+    std::uint32_t size_ = 0;
+    bool truncated_ = false;
+};
+
+template<typename T>
+struct is_with_context : std::false_type
+{};
+
+template<typename E>
+struct is_with_context<with_context<E>> : std::true_type
+{};
+
+template<typename T>
+constexpr bool is_with_context_v = is_with_context<T>::value;
+
+// Records a frame on error, wrapping it in with_context unless it already is
+template<typename E>
+auto add_context(
+    E&& error,
+    const char* message,
+    std::source_location location = std::source_location::current()
+);
+
+namespace internal {
+
+// Returned by the MICA_TRY_CONTEXT macros. Converts to the expected returned
+// by the enclosing function, the error is moved once into the return value
+// and the frame is added there.
+template<typename E>
+struct context_propagation
+{
+    template<typename T, typename G>
+    requires is_with_context_v<G> && std::constructible_from<G, E&&>
+    operator std::expected<T, G>() && noexcept(std::is_nothrow_constructible_v<G, E&&>);
+
+    E&& error;
+    const char* message;
+    std::source_location location;
+};
+
+template<typename E>
+context_propagation<E> propagate_context(E&& error, const char* message, std::source_location location) noexcept;
+
+} // namespace mica::internal
+
+template<error_type E>
+struct error_traits<with_context<E>>
+{
+    static with_context<E> from_exception(const std::exception& e);
+
+    static with_context<E> from_unknown();
+
+    static with_context<E> from_code(errc code);
+
+    static with_context<E> from_suppressed(errc code);
+
+    static with_context<E> from_errno(int code);
+};
+
+} // namespace mica
+
+#include <mica/context.inl>
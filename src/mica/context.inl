@@ -0,0 +1,186 @@
+#include <utility>
+
+namespace mica {
+
+constexpr context_chain::iterator::iterator(const context_frame* frames, std::size_t remaining) noexcept
+    : frames_(frames),
+      remaining_(remaining)
+{}
+
+constexpr const context_frame& context_chain::iterator::operator*() const noexcept
+{
+    return frames_[remaining_ - 1];
+}
+
+constexpr const context_frame* context_chain::iterator::operator->() const noexcept
+{
+    return &frames_[remaining_ - 1];
+}
+
+constexpr context_chain::iterator& context_chain::iterator::operator++() noexcept
+{
+    --remaining_;
+    return *this;
+}
+
+constexpr bool context_chain::iterator::operator!=(sentinel) const noexcept
+{
+    return remaining_ != 0;
+}
+
+constexpr context_chain::context_chain(const context_frame* frames, std::size_t size, bool truncated) noexcept
+    : frames_(frames),
+      size_(size),
+      truncated_(truncated)
+{}
+
+constexpr context_chain::iterator context_chain::begin() const noexcept
+{
+    return iterator(frames_, size_);
+}
+
+constexpr context_chain::sentinel context_chain::end() const noexcept
+{
+    return sentinel();
+}
+
+constexpr bool context_chain::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+constexpr std::size_t context_chain::size() const noexcept
+{
+    return size_;
+}
+
+constexpr bool context_chain::truncated() const noexcept
+{
+    return truncated_;
+}
+
+inline std::string to_string(const context_chain& chain)
+{
+    std::string output;
+    for (const context_frame& frame : chain) {
+        if (!output.empty()) {
+            output += '\n';
+        }
+        output += frame.message;
+        output += " (";
+        output += frame.location.file_name();
+        output += ':';
+        output += std::to_string(frame.location.line());
+        output += ", ";
+        output += frame.location.function_name();
+        output += ')';
+    }
+    // The dropped frames are the most recent ones
+    if (chain.truncated()) {
+        output.insert(0, output.empty() ? "..." : "...\n");
+    }
+    return output;
+}
+
+template<typename E>
+template<typename G>
+requires std::constructible_from<E, G&&> && (!std::same_as<std::remove_cvref_t<G>, with_context<E>>)
+constexpr with_context<E>::with_context(G&& error) noexcept(std::is_nothrow_constructible_v<E, G&&>)
+    : error_(std::forward<G>(error))
+{}
+
+template<typename E>
+constexpr const E& with_context<E>::error() const& noexcept
+{
+    return error_;
+}
+
+template<typename E>
+constexpr E&& with_context<E>::error() && noexcept
+{
+    return std::move(error_);
+}
+
+template<typename E>
+constexpr context_chain with_context<E>::context() const noexcept
+{
+    return context_chain(frames_.data(), size_, truncated_);
+}
+
+template<typename E>
+constexpr with_context<E>& with_context<E>::add_context(const char* message, std::source_location location) noexcept
+{
+    if (size_ < capacity) [[likely]] {
+        frames_[size_++] = context_frame{message, location};
+    } else {
+        truncated_ = true;
+    }
+    return *this;
+}
+
+template<typename E>
+auto add_context(E&& error, const char* message, std::source_location location)
+{
+    using T = std::remove_cvref_t<E>;
+    if constexpr (is_with_context_v<T>) {
+        T output(std::forward<E>(error));
+        output.add_context(message, location);
+        return output;
+    } else {
+        with_context<T> output(std::forward<E>(error));
+        output.add_context(message, location);
+        return output;
+    }
+}
+
+namespace internal {
+
+template<typename E>
+template<typename T, typename G>
+requires is_with_context_v<G> && std::constructible_from<G, E&&>
+context_propagation<E>::operator std::expected<T, G>() && noexcept(std::is_nothrow_constructible_v<G, E&&>)
+{
+    std::expected<T, G> output(std::unexpect, std::forward<E>(error));
+    output.error().add_context(message, location);
+    return output;
+}
+
+template<typename E>
+context_propagation<E> propagate_context(E&& error, const char* message, std::source_location location) noexcept
+{
+    return context_propagation<E>{std::forward<E>(error), message, location};
+}
+
+} // namespace mica::internal
+
+template<error_type E>
+with_context<E> error_traits<with_context<E>>::from_exception(const std::exception& e)
+{
+    return error_traits<E>::from_exception(e);
+}
+
+template<error_type E>
+with_context<E> error_traits<with_context<E>>::from_unknown()
+{
+    return error_traits<E>::from_unknown();
+}
+
+template<error_type E>
+with_context<E> error_traits<with_context<E>>::from_code(errc code)
+{
+    return error_traits<E>::from_code(code);
+}
+
+template<error_type E>
+with_context<E> error_traits<with_context<E>>::from_suppressed(errc code)
+{
+    return internal::suppressed_error<E>(code);
+}
+
+template<error_type E>
+with_context<E> error_traits<with_context<E>>::from_errno(int code)
+{
+    return internal::errno_error<E>(code);
+}
+
+} // namespace mica
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mica/call_site.hpp>
+#include <mica/per_thread.hpp>
+#include <mica/policy.hpp>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+// Counting is compiled in only when MICA_COUNTERS is 1. When it is 0,
+// counted policies behave exactly like the policy they wrap and the MICA_TRY
+// macros record nothing.
+#ifndef MICA_COUNTERS
+#define MICA_COUNTERS 0
+#endif
+
+namespace mica {
+
+// Bounds the exception types counted per call site and thread, further
+// types are counted as "other"
+struct counter_policy
+{
+    static constexpr std::size_t exception_types_per_site = 4;
+};
+
+namespace internal {
+
+// Written only by the owning thread, read by snapshots. Relaxed loads and
+// stores of a thread's own counters compile to plain moves.
+struct alignas(64) site_counters
+{
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> failures;
+    std::atomic<std::uint64_t> other_exceptions;
+    std::array<std::atomic<const std::type_info*>, counter_policy::exception_types_per_site> exception_types;
+    std::array<std::atomic<std::uint64_t>, counter_policy::exception_types_per_site> exception_counts;
+};
+
+struct counter_block
+{
+    void merge(const counter_block& other) noexcept;
+
+    std::array<site_counters, call_site_policy::max_sites> sites{};
+    counter_block* previous = nullptr;
+    counter_block* next = nullptr;
+};
+
+// Type of the exception being handled, nullptr if unknown
+const std::type_info* current_exception_type() noexcept;
+
+template<typename Site>
+void count_call(bool failed) noexcept;
+
+template<typename Site>
+void count_exception(const std::type_info* type) noexcept;
+
+template<typename Site>
+struct counting_observer
+{
+    void success() noexcept;
+
+    void failure() noexcept;
+};
+
+} // namespace mica::internal
+
+// Wraps an error policy and counts the calls, failures and exception types
+// of one call site, see MICA_CALL_SITE:
+//     make_noexcept<parse, mica::counted<std::string, MICA_CALL_SITE>>(text);
+template<error_policy Policy, typename Site>
+struct counted
+{};
+
+template<error_policy Policy, typename Site>
+struct policy_traits<counted<Policy, Site>>
+{
+    using error_type = policy_error_t<Policy>;
+    using handlers = typename policy_traits<Policy>::handlers;
+    using fallback = internal::policy_fallback_t<Policy>;
+#if MICA_COUNTERS
+    using observer = internal::chain_observers_t<
+        internal::policy_observer_t<Policy>,
+        internal::counting_observer<Site>
+    >;
+#else
+    using observer = internal::policy_observer_t<Policy>;
+#endif
+};
+
+struct exception_count
+{
+    std::string type;
+    std::uint64_t count;
+};
+
+struct call_site_counters
+{
+    std::uint64_t id;
+    std::string_view file;
+    std::uint32_t line;
+    std::uint64_t calls;
+    std::uint64_t failures;
+    std::vector<exception_count> exceptions;
+};
+
+// Counters of every call site that was reached, merged across the live
+// threads and the threads that exited
+struct counter_snapshot
+{
+    std::vector<call_site_counters> sites;
+};
+
+counter_snapshot snapshot_counters();
+
+// One line per call site, followed by one indented line per exception type
+std::string to_string(const counter_snapshot& snapshot);
+
+std::string to_json(const counter_snapshot& snapshot);
+
+} // namespace mica
+
+#include <mica/counters.inl>
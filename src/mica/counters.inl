@@ -0,0 +1,231 @@
+#include <cstdlib>
+#include <memory>
+#include <utility>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define _MICA_INTERNAL_HAS_CXXABI 1
+#else
+#define _MICA_INTERNAL_HAS_CXXABI 0
+#endif
+
+namespace mica {
+
+namespace internal {
+
+inline void bump(std::atomic<std::uint64_t>& counter, std::uint64_t count = 1) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+}
+
+inline void add_exception(site_counters& counters, const std::type_info* type, std::uint64_t count) noexcept
+{
+    if (type != nullptr) {
+        for (std::size_t i = 0; i < counter_policy::exception_types_per_site; ++i) {
+            const std::type_info* slot = counters.exception_types[i].load(std::memory_order_relaxed);
+            if (slot == nullptr) {
+                counters.exception_types[i].store(type, std::memory_order_relaxed);
+                bump(counters.exception_counts[i], count);
+                return;
+            }
+            if (*slot == *type) {
+                bump(counters.exception_counts[i], count);
+                return;
+            }
+        }
+    }
+    bump(counters.other_exceptions, count);
+}
+
+inline void counter_block::merge(const counter_block& other) noexcept
+{
+    for (std::size_t index = 0; index < call_site_policy::max_sites; ++index) {
+        site_counters& into = sites[index];
+        const site_counters& from = other.sites[index];
+        bump(into.calls, from.calls.load(std::memory_order_relaxed));
+        bump(into.failures, from.failures.load(std::memory_order_relaxed));
+        bump(into.other_exceptions, from.other_exceptions.load(std::memory_order_relaxed));
+        for (std::size_t i = 0; i < counter_policy::exception_types_per_site; ++i) {
+            const std::type_info* type = from.exception_types[i].load(std::memory_order_relaxed);
+            if (type != nullptr) {
+                add_exception(into, type, from.exception_counts[i].load(std::memory_order_relaxed));
+            }
+        }
+    }
+}
+
+inline const std::type_info* current_exception_type() noexcept
+{
+#if _MICA_INTERNAL_HAS_CXXABI
+    return abi::__cxa_current_exception_type();
+#else
+    return nullptr;
+#endif
+}
+
+template<typename Site>
+void count_call(bool failed) noexcept
+{
+    const std::size_t index = site_index<Site>();
+    counter_block* block = local_block<counter_block>();
+    if (index == no_site || block == nullptr) [[unlikely]] {
+        return;
+    }
+    site_counters& counters = block->sites[index];
+    bump(counters.calls);
+    if (failed) {
+        bump(counters.failures);
+    }
+}
+
+template<typename Site>
+void count_exception(const std::type_info* type) noexcept
+{
+    const std::size_t index = site_index<Site>();
+    counter_block* block = local_block<counter_block>();
+    if (index == no_site || block == nullptr) [[unlikely]] {
+        return;
+    }
+    site_counters& counters = block->sites[index];
+    bump(counters.calls);
+    bump(counters.failures);
+    add_exception(counters, type, 1);
+}
+
+template<typename Site>
+void counting_observer<Site>::success() noexcept
+{
+    count_call<Site>(false);
+}
+
+template<typename Site>
+[[gnu::cold]] void counting_observer<Site>::failure() noexcept
+{
+    count_exception<Site>(current_exception_type());
+}
+
+inline std::string type_name(const std::type_info& type)
+{
+#if _MICA_INTERNAL_HAS_CXXABI
+    int status = 0;
+    std::unique_ptr<char, decltype(&std::free)> name(
+        abi::__cxa_demangle(type.name(), nullptr, nullptr, &status),
+        &std::free
+    );
+    if (status == 0 && name != nullptr) {
+        return name.get();
+    }
+#endif
+    return type.name();
+}
+
+struct site_exceptions
+{
+    std::vector<std::pair<const std::type_info*, std::uint64_t>> types;
+    std::uint64_t other = 0;
+};
+
+} // namespace mica::internal
+
+inline counter_snapshot snapshot_counters()
+{
+    using namespace internal;
+    const std::vector<site_info> sites = registered_sites();
+    counter_snapshot output;
+    output.sites.reserve(sites.size());
+    for (const site_info& info : sites) {
+        output.sites.push_back(call_site_counters{info.id, info.file, info.line, 0, 0, {}});
+    }
+    std::vector<site_exceptions> exceptions(sites.size());
+    block_registry<counter_block>::global().visit([&](const counter_block& block) {
+        for (std::size_t index = 0; index < sites.size(); ++index) {
+            const site_counters& counters = block.sites[index];
+            call_site_counters& site = output.sites[index];
+            auto& types = exceptions[index].types;
+            site.calls += counters.calls.load(std::memory_order_relaxed);
+            site.failures += counters.failures.load(std::memory_order_relaxed);
+            exceptions[index].other += counters.other_exceptions.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < counter_policy::exception_types_per_site; ++i) {
+                const std::type_info* type = counters.exception_types[i].load(std::memory_order_relaxed);
+                const std::uint64_t count = counters.exception_counts[i].load(std::memory_order_relaxed);
+                if (type == nullptr || count == 0) {
+                    continue;
+                }
+                auto it = types.begin();
+                while (it != types.end() && *it->first != *type) {
+                    ++it;
+                }
+                if (it == types.end()) {
+                    types.emplace_back(type, count);
+                } else {
+                    it->second += count;
+                }
+            }
+        }
+    });
+    for (std::size_t index = 0; index < sites.size(); ++index) {
+        for (const auto& [type, count] : exceptions[index].types) {
+            output.sites[index].exceptions.push_back(exception_count{type_name(*type), count});
+        }
+        if (exceptions[index].other != 0) {
+            output.sites[index].exceptions.push_back(exception_count{"other", exceptions[index].other});
+        }
+    }
+    return output;
+}
+
+inline std::string to_string(const counter_snapshot& snapshot)
+{
+    std::string output;
+    for (const call_site_counters& site : snapshot.sites) {
+        output += site.file;
+        output += ':';
+        output += std::to_string(site.line);
+        output += " calls ";
+        output += std::to_string(site.calls);
+        output += " failures ";
+        output += std::to_string(site.failures);
+        output += '\n';
+        for (const exception_count& exception : site.exceptions) {
+            output += "    ";
+            output += exception.type;
+            output += ' ';
+            output += std::to_string(exception.count);
+            output += '\n';
+        }
+    }
+    return output;
+}
+
+inline std::string to_json(const counter_snapshot& snapshot)
+{
+    std::string output = "{\"sites\":[";
+    for (std::size_t i = 0; i < snapshot.sites.size(); ++i) {
+        const call_site_counters& site = snapshot.sites[i];
+        if (i != 0) {
+            output += ',';
+        }
+        output += '{';
+        internal::append_site_json(output, internal::site_info{site.id, site.file, site.line});
+        output += ",\"calls\":";
+        output += std::to_string(site.calls);
+        output += ",\"failures\":";
+        output += std::to_string(site.failures);
+        output += ",\"exceptions\":[";
+        for (std::size_t j = 0; j < site.exceptions.size(); ++j) {
+            if (j != 0) {
+                output += ',';
+            }
+            output += "{\"type\":";
+            internal::append_json_string(output, site.exceptions[j].type);
+            output += ",\"count\":";
+            output += std::to_string(site.exceptions[j].count);
+            output += '}';
+        }
+        output += "]}";
+    }
+    output += "]}";
+    return output;
+}
+
+} // namespace mica
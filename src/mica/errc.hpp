@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace mica {
+
+enum class errc : std::uint16_t {
+    unknown,
+    exception,
+    bad_alloc,
+    bad_array_new_length,
+    bad_cast,
+    bad_typeid,
+    bad_function_call,
+    logic_error,
+    invalid_argument,
+    domain_error,
+    length_error,
+    out_of_range,
+    runtime_error,
+    range_error,
+    overflow_error,
+    underflow_error,
+    system_error,
+    truncated,
+    bad_optional_access,
+    bad_variant_access,
+    bad_any_cast,
+};
+
+constexpr std::string_view to_string(errc code) noexcept;
+
+} // namespace mica
+
+#include <mica/errc.inl>
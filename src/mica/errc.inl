@@ -0,0 +1,48 @@
+#include <cstddef>
+#include <iterator>
+
+namespace mica {
+
+namespace internal {
+
+inline constexpr const char* errc_messages[] = {
+    "unknown error",
+    "exception",
+    "bad allocation",
+    "bad array new length",
+    "bad cast",
+    "bad typeid",
+    "bad function call",
+    "logic error",
+    "invalid argument",
+    "domain error",
+    "length error",
+    "out of range",
+    "runtime error",
+    "range error",
+    "overflow error",
+    "underflow error",
+    "system error",
+    "output truncated",
+    "bad optional access",
+    "bad variant access",
+    "bad any cast",
+};
+
+constexpr const char* errc_message(errc code) noexcept
+{
+    auto index = static_cast<std::size_t>(code);
+    if (index >= std::size(errc_messages)) {
+        return errc_messages[0];
+    }
+    return errc_messages[index];
+}
+
+} // namespace mica::internal
+
+constexpr std::string_view to_string(errc code) noexcept
+{
+    return internal::errc_message(code);
+}
+
+} // namespace mica
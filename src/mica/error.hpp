@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <mica/errc.hpp>
+#include <mica/error_traits.hpp>
+#include <string_view>
+
+namespace mica {
+
+enum class error_category : std::uint16_t {
+    // code is an errc
+    mica,
+    // code is an errno value
+    system,
+    // code and message are chosen by the caller
+    user,
+};
+
+// Allocation-free error value. The message is never owned, it must point to
+// storage that outlives the error (string literals, errc table entries).
+// Packed so that std::expected<int, mica::error> fits in 16 bytes.
+class [[gnu::packed]] error {
+public:
+    constexpr error() noexcept;
+
+    constexpr error(errc code) noexcept;
+
+    // Implicit so MICA_TRY_STATIC can return a string literal
+    constexpr error(const char* message) noexcept;
+
+    constexpr error(error_category category, std::uint16_t code, const char* message) noexcept;
+
+    constexpr error_category category() const noexcept;
+
+    constexpr std::uint16_t code() const noexcept;
+
+    constexpr const char* message() const noexcept;
+
+    friend constexpr bool operator==(const error& lhs, const error& rhs) noexcept = default;
+
+    friend constexpr bool operator==(const error& lhs, errc rhs) noexcept;
+
+private:
+    const char* message_;
+    error_category category_;
+    std::uint16_t code_;
+};
+
+template<>
+struct error_traits<error>
+{
+    static error from_exception(const std::exception& e) noexcept;
+
+    static error from_unknown() noexcept;
+
+    static error from_code(errc code) noexcept;
+
+    // Keeps the code, the message is the suppressed marker
+    static error from_suppressed(errc code) noexcept;
+
+    // Category system, the message of uncommon errno values is generic
+    static error from_errno(int code) noexcept;
+};
+
+namespace internal {
+
+// Code of the most derived standard exception type e is an instance of
+inline errc exception_code(const std::exception& e) noexcept;
+
+} // namespace mica::internal
+
+} // namespace mica
+
+#include <mica/error.inl>
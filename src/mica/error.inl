@@ -0,0 +1,142 @@
+#include <any>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+#include <typeinfo>
+#include <variant>
+
+namespace mica {
+
+namespace internal {
+
+template<typename Ex>
+bool is_exception(const std::exception& e) noexcept
+{
+    return dynamic_cast<const Ex*>(&e) != nullptr;
+}
+
+} // namespace mica::internal
+
+constexpr error::error() noexcept
+    : error(errc::unknown)
+{}
+
+constexpr error::error(errc code) noexcept
+    : message_(internal::errc_message(code)),
+      category_(error_category::mica),
+      code_(static_cast<std::uint16_t>(code))
+{}
+
+constexpr error::error(const char* message) noexcept
+    : message_(message),
+      category_(error_category::user),
+      code_(0)
+{}
+
+constexpr error::error(error_category category, std::uint16_t code, const char* message) noexcept
+    : message_(message),
+      category_(category),
+      code_(code)
+{}
+
+constexpr error_category error::category() const noexcept
+{
+    return category_;
+}
+
+constexpr std::uint16_t error::code() const noexcept
+{
+    return code_;
+}
+
+constexpr const char* error::message() const noexcept
+{
+    return message_;
+}
+
+constexpr bool operator==(const error& lhs, errc rhs) noexcept
+{
+    return lhs.category() == error_category::mica
+        && lhs.code() == static_cast<std::uint16_t>(rhs);
+}
+
+namespace internal {
+
+// Most derived types are checked first
+inline errc exception_code(const std::exception& e) noexcept
+{
+    if (is_exception<std::bad_array_new_length>(e)) {
+        return errc::bad_array_new_length;
+    } else if (is_exception<std::bad_alloc>(e)) {
+        return errc::bad_alloc;
+    } else if (is_exception<std::invalid_argument>(e)) {
+        return errc::invalid_argument;
+    } else if (is_exception<std::domain_error>(e)) {
+        return errc::domain_error;
+    } else if (is_exception<std::length_error>(e)) {
+        return errc::length_error;
+    } else if (is_exception<std::out_of_range>(e)) {
+        return errc::out_of_range;
+    } else if (is_exception<std::logic_error>(e)) {
+        return errc::logic_error;
+    } else if (is_exception<std::system_error>(e)) {
+        return errc::system_error;
+    } else if (is_exception<std::range_error>(e)) {
+        return errc::range_error;
+    } else if (is_exception<std::overflow_error>(e)) {
+        return errc::overflow_error;
+    } else if (is_exception<std::underflow_error>(e)) {
+        return errc::underflow_error;
+    } else if (is_exception<std::runtime_error>(e)) {
+        return errc::runtime_error;
+    } else if (is_exception<std::bad_optional_access>(e)) {
+        return errc::bad_optional_access;
+    } else if (is_exception<std::bad_variant_access>(e)) {
+        return errc::bad_variant_access;
+    } else if (is_exception<std::bad_any_cast>(e)) {
+        return errc::bad_any_cast;
+    } else if (is_exception<std::bad_cast>(e)) {
+        return errc::bad_cast;
+    } else if (is_exception<std::bad_typeid>(e)) {
+        return errc::bad_typeid;
+    } else if (is_exception<std::bad_function_call>(e)) {
+        return errc::bad_function_call;
+    }
+    return errc::exception;
+}
+
+} // namespace mica::internal
+
+inline error error_traits<error>::from_exception(const std::exception& e) noexcept
+{
+    return internal::exception_code(e);
+}
+
+inline error error_traits<error>::from_unknown() noexcept
+{
+    return errc::unknown;
+}
+
+inline error error_traits<error>::from_code(errc code) noexcept
+{
+    return code;
+}
+
+inline error error_traits<error>::from_suppressed(errc code) noexcept
+{
+    return error(error_category::mica, static_cast<std::uint16_t>(code), internal::suppressed_message);
+}
+
+inline error error_traits<error>::from_errno(int code) noexcept
+{
+    const char* message = internal::errno_message(code);
+    if (message == nullptr) {
+        message = internal::errc_message(errc::system_error);
+    }
+    return error(error_category::system, static_cast<std::uint16_t>(code), message);
+}
+
+} // namespace mica
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <concepts>
+#include <exception>
+#include <mica/errc.hpp>
+#include <string>
+#include <string_view>
+
+namespace mica {
+
+// Describes how mica builds an error of type E from a caught exception or from
+// an errc reported by mica itself. Specialize for custom error types.
+// Specializations may also provide from_suppressed(errc), building the error
+// of a failure whose message was not captured, see mica::sampled, or
+// from_suppressed() when that error does not depend on the code, and
+// from_errno(int), building the error of a failed system call, see mica::io.
+template<typename E>
+struct error_traits;
+
+template<>
+struct error_traits<std::string>
+{
+    static std::string from_exception(const std::exception& e);
+
+    static std::string from_unknown();
+
+    static std::string from_code(errc code);
+
+    // The marker alone, short enough to need no allocation
+    static std::string from_suppressed();
+
+    static std::string from_errno(int code);
+};
+
+template<typename E>
+concept error_type = requires(const std::exception& e, errc code) {
+    { error_traits<E>::from_exception(e) } -> std::same_as<E>;
+    { error_traits<E>::from_unknown() } -> std::same_as<E>;
+    { error_traits<E>::from_code(code) } -> std::same_as<E>;
+};
+
+namespace internal {
+
+inline constexpr const char* suppressed_message = "message suppressed";
+
+// Within the small buffer of std::string
+inline constexpr const char* short_suppressed_message = "suppressed";
+
+template<typename E>
+concept suppressed_without_code = requires {
+    { error_traits<E>::from_suppressed() } -> std::same_as<E>;
+};
+
+// from_suppressed when E provides it, from_code otherwise
+template<error_type E>
+E suppressed_error(errc code);
+
+// Message of the common errno values, nullptr for the others
+constexpr const char* errno_message(int code) noexcept;
+
+// from_errno when E provides it, from_code(errc::system_error) otherwise
+template<error_type E>
+E errno_error(int code);
+
+} // namespace mica::internal
+
+} // namespace mica
+
+#include <mica/error_traits.inl>
@@ -0,0 +1,111 @@
+#include <cerrno>
+#include <system_error>
+
+namespace mica {
+
+inline std::string error_traits<std::string>::from_exception(const std::exception& e)
+{
+    return e.what();
+}
+
+inline std::string error_traits<std::string>::from_unknown()
+{
+    return "unexpected error";
+}
+
+inline std::string error_traits<std::string>::from_code(errc code)
+{
+    return std::string(to_string(code));
+}
+
+inline std::string error_traits<std::string>::from_suppressed()
+{
+    return internal::short_suppressed_message;
+}
+
+inline std::string error_traits<std::string>::from_errno(int code)
+{
+    if (const char* message = internal::errno_message(code)) {
+        return message;
+    }
+    return std::generic_category().message(code);
+}
+
+namespace internal {
+
+template<error_type E>
+E suppressed_error(errc code)
+{
+    if constexpr (suppressed_without_code<E>) {
+        return error_traits<E>::from_suppressed();
+    } else if constexpr (requires { { error_traits<E>::from_suppressed(code) } -> std::same_as<E>; }) {
+        return error_traits<E>::from_suppressed(code);
+    } else {
+        return error_traits<E>::from_code(code);
+    }
+}
+
+constexpr const char* errno_message(int code) noexcept
+{
+    switch (code) {
+    case EPERM:
+        return "operation not permitted";
+    case ENOENT:
+        return "no such file or directory";
+    case EINTR:
+        return "interrupted system call";
+    case EIO:
+        return "input/output error";
+    case EBADF:
+        return "bad file descriptor";
+    case EAGAIN:
+        return "resource temporarily unavailable";
+    case ENOMEM:
+        return "not enough memory";
+    case EACCES:
+        return "permission denied";
+    case EBUSY:
+        return "device or resource busy";
+    case EEXIST:
+        return "file exists";
+    case ENODEV:
+        return "no such device";
+    case ENOTDIR:
+        return "not a directory";
+    case EISDIR:
+        return "is a directory";
+    case EINVAL:
+        return "invalid argument";
+    case ENFILE:
+        return "too many open files in system";
+    case EMFILE:
+        return "too many open files";
+    case EFBIG:
+        return "file too large";
+    case ENOSPC:
+        return "no space left on device";
+    case EROFS:
+        return "read-only file system";
+    case ENAMETOOLONG:
+        return "file name too long";
+    case ELOOP:
+        return "too many levels of symbolic links";
+    case EOVERFLOW:
+        return "value too large for defined data type";
+    }
+    return nullptr;
+}
+
+template<error_type E>
+E errno_error(int code)
+{
+    if constexpr (requires { { error_traits<E>::from_errno(code) } -> std::same_as<E>; }) {
+        return error_traits<E>::from_errno(code);
+    } else {
+        return error_traits<E>::from_code(errc::system_error);
+    }
+}
+
+} // namespace mica::internal
+
+} // namespace mica
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <mica/task.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mica {
+
+namespace internal {
+
+struct schedule_node
+{
+    schedule_node* next;
+    std::coroutine_handle<> handle;
+};
+
+// Intrusive FIFO of suspended coroutines. Nodes live in the frames of the
+// queued coroutines, so scheduling never allocates.
+class schedule_queue {
+public:
+    void push(schedule_node* node) noexcept;
+
+    // Waits for a node, returns nullptr once stopped and empty
+    schedule_node* pop() noexcept;
+
+    void stop() noexcept;
+
+private:
+    schedule_node* pop_locked() noexcept;
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    schedule_node* head_ = nullptr;
+    schedule_node* tail_ = nullptr;
+    bool stopped_ = false;
+};
+
+template<typename Executor>
+class schedule_awaiter {
+public:
+    explicit schedule_awaiter(Executor& executor) noexcept;
+
+    bool await_ready() const noexcept;
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept;
+
+    void await_resume() const noexcept;
+
+private:
+    Executor& executor_;
+    schedule_node node_{};
+};
+
+} // namespace mica::internal
+
+// Single-threaded executor, coroutines scheduled on it are resumed by the
+// thread calling run. Other threads may schedule onto it.
+class run_loop {
+public:
+    run_loop() = default;
+
+    run_loop(const run_loop&) = delete;
+
+    run_loop& operator=(const run_loop&) = delete;
+
+    // co_await schedule() resumes the awaiting coroutine inside run
+    internal::schedule_awaiter<run_loop> schedule() noexcept;
+
+    // Starts t and resumes scheduled coroutines until t completes
+    template<typename T>
+    T run(task<T> t);
+
+private:
+    friend class internal::schedule_awaiter<run_loop>;
+
+    void enqueue(internal::schedule_node* node) noexcept;
+
+    internal::schedule_queue queue_;
+};
+
+// Multi-threaded executor, scheduled coroutines are resumed by the first
+// free worker thread.
+class thread_executor {
+public:
+    explicit thread_executor(std::size_t threads = std::thread::hardware_concurrency());
+
+    thread_executor(const thread_executor&) = delete;
+
+    thread_executor& operator=(const thread_executor&) = delete;
+
+    // Resumes the coroutines already scheduled, then joins the threads
+    ~thread_executor();
+
+    std::size_t size() const noexcept;
+
+    // co_await schedule() resumes the awaiting coroutine on a worker thread
+    internal::schedule_awaiter<thread_executor> schedule() noexcept;
+
+private:
+    friend class internal::schedule_awaiter<thread_executor>;
+
+    void enqueue(internal::schedule_node* node) noexcept;
+
+    internal::schedule_queue queue_;
+    std::vector<std::thread> threads_;
+};
+
+} // namespace mica
+
+#include <mica/executor.inl>
@@ -0,0 +1,152 @@
+#include <algorithm>
+
+namespace mica {
+
+namespace internal {
+
+inline void schedule_queue::push(schedule_node* node) noexcept
+{
+    node->next = nullptr;
+    {
+        std::lock_guard lock(mutex_);
+        if (tail_ == nullptr) {
+            head_ = node;
+        } else {
+            tail_->next = node;
+        }
+        tail_ = node;
+    }
+    ready_.notify_one();
+}
+
+inline schedule_node* schedule_queue::pop() noexcept
+{
+    std::unique_lock lock(mutex_);
+    ready_.wait(lock, [&]() { return head_ != nullptr || stopped_; });
+    return pop_locked();
+}
+
+inline void schedule_queue::stop() noexcept
+{
+    {
+        std::lock_guard lock(mutex_);
+        stopped_ = true;
+    }
+    ready_.notify_all();
+}
+
+inline schedule_node* schedule_queue::pop_locked() noexcept
+{
+    schedule_node* node = head_;
+    if (node != nullptr) {
+        head_ = node->next;
+        if (head_ == nullptr) {
+            tail_ = nullptr;
+        }
+    }
+    return node;
+}
+
+template<typename Executor>
+schedule_awaiter<Executor>::schedule_awaiter(Executor& executor) noexcept
+    : executor_(executor)
+{}
+
+template<typename Executor>
+bool schedule_awaiter<Executor>::await_ready() const noexcept
+{
+    return false;
+}
+
+template<typename Executor>
+void schedule_awaiter<Executor>::await_suspend(std::coroutine_handle<> handle) noexcept
+{
+    node_.handle = handle;
+    executor_.enqueue(&node_);
+}
+
+template<typename Executor>
+void schedule_awaiter<Executor>::await_resume() const noexcept
+{}
+
+// Queues its wakeup node once the task of run_loop::run completed, which also
+// wakes run when the task completed on another thread
+struct loop_waiter : task_waiter
+{
+    explicit loop_waiter(schedule_queue& queue) noexcept
+        : task_waiter{&notify},
+          queue(queue)
+    {}
+
+    static std::coroutine_handle<> notify(task_waiter& waiter) noexcept
+    {
+        auto& self = static_cast<loop_waiter&>(waiter);
+        self.queue.push(&self.wakeup);
+        return std::noop_coroutine();
+    }
+
+    schedule_queue& queue;
+    schedule_node wakeup{};
+};
+
+} // namespace mica::internal
+
+inline internal::schedule_awaiter<run_loop> run_loop::schedule() noexcept
+{
+    return internal::schedule_awaiter<run_loop>(*this);
+}
+
+template<typename T>
+T run_loop::run(task<T> t)
+{
+    internal::loop_waiter waiter(queue_);
+    t.handle_.promise().set_waiter(&waiter);
+    t.handle_.resume();
+    for (internal::schedule_node* node = queue_.pop(); node != &waiter.wakeup; node = queue_.pop()) {
+        node->handle.resume();
+    }
+    return t.handle_.promise().take();
+}
+
+inline void run_loop::enqueue(internal::schedule_node* node) noexcept
+{
+    queue_.push(node);
+}
+
+inline thread_executor::thread_executor(std::size_t threads)
+{
+    const std::size_t count = std::max<std::size_t>(threads, 1);
+    threads_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        threads_.emplace_back([this]() {
+            while (internal::schedule_node* node = queue_.pop()) {
+                node->handle.resume();
+            }
+        });
+    }
+}
+
+inline thread_executor::~thread_executor()
+{
+    queue_.stop();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+inline std::size_t thread_executor::size() const noexcept
+{
+    return threads_.size();
+}
+
+inline internal::schedule_awaiter<thread_executor> thread_executor::schedule() noexcept
+{
+    return internal::schedule_awaiter<thread_executor>(*this);
+}
+
+inline void thread_executor::enqueue(internal::schedule_node* node) noexcept
+{
+    queue_.push(node);
+}
+
+} // namespace mica
@@ -1,12 +1,78 @@
 #pragma once
 
+#include <cstddef>
+#include <expected>
 #include <format>
+#include <iterator>
+#include <memory_resource>
+#include <mica/arena.hpp>
+#include <mica/format_plan.hpp>
+#include <mica/policy.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace mica {
 
+// Format string checked like std::format_string, and split into a plan at
+// compile time. When every replacement field has an empty format spec and
+// every argument is an integer, float, double or string, the functions below
+// write the output themselves, into storage sized for a bound computed up
+// front. A new string whose output fits its small buffer moves there, longer
+// ones keep the bound as their capacity. Anything else goes through
+// std::format.
 template<typename... Args>
-std::expected<std::string, std::string>
-format(std::format_string<Args...> fmt, Args&&... args) noexcept;
+class basic_format_string {
+public:
+    template<typename S>
+    requires std::convertible_to<const S&, std::string_view>
+    consteval basic_format_string(const S& text);
+
+    // Strings checked at run time always go through std::format
+    constexpr basic_format_string(std::format_string<Args...> fmt) noexcept;
+
+    constexpr std::string_view get() const noexcept;
+
+    constexpr std::format_string<Args...> std_format_string() const noexcept;
+
+    constexpr const internal::format_plan<sizeof...(Args)>& plan() const noexcept;
+
+private:
+    std::format_string<Args...> fmt_;
+    internal::format_plan<sizeof...(Args)> plan_;
+};
+
+template<typename... Args>
+using format_string = basic_format_string<std::type_identity_t<Args>...>;
+
+template<typename Policy = std::string, typename... Args>
+std::expected<std::string, policy_error_t<Policy>>
+format(format_string<Args...> fmt, Args&&... args) noexcept;
+
+// Format into a string allocated from resource. Errors are allocated from
+// resource as well.
+template<typename Policy = std::pmr::string, typename... Args>
+std::expected<std::pmr::string, policy_error_t<Policy>>
+format(std::pmr::memory_resource* resource, format_string<Args...> fmt, Args&&... args) noexcept;
+
+// Format through out. Returns the number of characters written.
+template<typename Policy = std::string, std::output_iterator<const char&> OutIt, typename... Args>
+std::expected<std::size_t, policy_error_t<Policy>>
+format_to(OutIt out, format_string<Args...> fmt, Args&&... args) noexcept;
+
+// Format into buffer without allocating. Returns the number of characters
+// written, or errc::truncated if the output does not fit in buffer.
+template<typename Policy = std::string, typename... Args>
+std::expected<std::size_t, policy_error_t<Policy>>
+format_to_n(std::span<char> buffer, format_string<Args...> fmt, Args&&... args) noexcept;
+
+// Format into out, replacing its contents. The existing capacity of out is
+// reused, so formatting repeatedly into the same string only allocates when
+// the output outgrows it.
+template<typename Policy = std::string, typename... Args>
+std::expected<void, policy_error_t<Policy>>
+format_into(std::string& out, format_string<Args...> fmt, Args&&... args) noexcept;
 
 } // namespace mica
 
@@ -1,24 +1,302 @@
-#include <mica/resolve.hpp>
+#include <mica/lift.hpp>
 #include <mica/make_noexcept.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <utility>
 
 namespace mica {
 
 namespace internal {
 
+// std::format and friends are overloaded on a leading locale. Lifting them
+// lets make_noexcept call the overload directly instead of through a pointer.
+inline constexpr auto format_fn = MICA_LIFT(std::format);
+
+inline constexpr auto format_to_fn = MICA_LIFT(std::format_to);
+
+inline constexpr auto format_to_n_fn = MICA_LIFT(std::format_to_n);
+
+// String literal arguments decay to pointers, as they do for std::format
+template<typename T>
+constexpr decltype(auto) fast_arg(const T& value) noexcept
+{
+    if constexpr (std::is_array_v<T>) {
+        return static_cast<const std::remove_extent_t<T>*>(value);
+    } else {
+        return (value);
+    }
+}
+
 template<typename... Args>
-using FormatSig = std::string(std::format_string<Args...>, Args&&...);
+std::size_t planned_size(const format_plan<sizeof...(Args)>& plan, const Args&... args) noexcept
+{
+    std::size_t size = plan.literal_size;
+    [[maybe_unused]] std::size_t index = 0;
+    ((size += plan.uses[index++] * max_formatted_size(fast_arg(args))), ...);
+    return size;
+}
 
+// Writes the output of plan at out, which has room for planned_size
+// characters. Returns the end of the output. The plan is a constant, once the
+// loop is unrolled every segment folds into a copy or a direct write.
 template<typename... Args>
-constexpr auto format_ptr = mica::resolve<FormatSig<Args...>, &std::format<Args...>>();
+char* write_planned(
+    char* out,
+    std::string_view text,
+    const format_plan<sizeof...(Args)>& plan,
+    const Args&... args
+) noexcept
+{
+#pragma GCC unroll 16
+    for (std::size_t i = 0; i < plan.count; ++i) {
+        const format_segment& segment = plan.segments[i];
+        if (segment.arg == format_segment::no_arg) {
+            std::memcpy(out, text.data() + segment.begin, segment.size);
+            out += segment.size;
+            continue;
+        }
+        [[maybe_unused]] std::uint32_t index = 0;
+        static_cast<void>(((index++ == segment.arg
+            && (out = write_format_arg(out, fast_arg(args)), true)) || ...));
+    }
+    return out;
+}
+
+// Largest bound format_to and format_to_n write on the stack
+inline constexpr std::size_t format_stack_size = 256;
+
+// Moves a new string sized for the bound into its own small buffer when the
+// output fits there. Longer outputs keep the bound as their capacity,
+// shrinking them would take a second allocation.
+template<typename String>
+void release_bound(String& out) noexcept
+{
+    if (out.capacity() > out.size() && out.size() <= String(out.get_allocator()).capacity()) {
+        out.shrink_to_fit();
+    }
+}
 
 } // namespace mica::internal
 
 template<typename... Args>
-std::expected<std::string, std::string>
-format(std::format_string<Args...> fmt, Args&&... args) noexcept
+template<typename S>
+requires std::convertible_to<const S&, std::string_view>
+consteval basic_format_string<Args...>::basic_format_string(const S& text)
+    : fmt_(text)
+{
+    if constexpr (internal::fast_format_args<Args...>) {
+        plan_ = internal::make_format_plan<sizeof...(Args)>(std::string_view(text));
+    }
+}
+
+template<typename... Args>
+constexpr basic_format_string<Args...>::basic_format_string(std::format_string<Args...> fmt) noexcept
+    : fmt_(fmt)
+{}
+
+template<typename... Args>
+constexpr std::string_view basic_format_string<Args...>::get() const noexcept
+{
+    return fmt_.get();
+}
+
+template<typename... Args>
+constexpr std::format_string<Args...> basic_format_string<Args...>::std_format_string() const noexcept
+{
+    return fmt_;
+}
+
+template<typename... Args>
+constexpr const internal::format_plan<sizeof...(Args)>& basic_format_string<Args...>::plan() const noexcept
+{
+    return plan_;
+}
+
+template<typename Policy, typename... Args>
+std::expected<std::string, policy_error_t<Policy>>
+format(format_string<Args...> fmt, Args&&... args) noexcept
+{
+    if constexpr (internal::fast_format_args<Args...>) {
+        if (fmt.plan().fast) {
+            // Only the allocation can throw
+            return make_noexcept<Policy>([&]() -> std::string {
+                std::string output;
+                output.resize_and_overwrite(
+                    internal::planned_size(fmt.plan(), args...),
+                    [&](char* data, std::size_t) noexcept {
+                        char* end = internal::write_planned(data, fmt.get(), fmt.plan(), args...);
+                        return static_cast<std::size_t>(end - data);
+                    }
+                );
+                internal::release_bound(output);
+                return output;
+            });
+        }
+    }
+    return make_noexcept<internal::format_fn, Policy>(fmt.std_format_string(), std::forward<Args>(args)...);
+}
+
+template<typename Policy, typename... Args>
+std::expected<std::pmr::string, policy_error_t<Policy>>
+format(std::pmr::memory_resource* resource, format_string<Args...> fmt, Args&&... args) noexcept
+{
+    scoped_resource scope(resource);
+    if constexpr (internal::fast_format_args<Args...>) {
+        if (fmt.plan().fast) {
+            return make_noexcept<Policy>([&]() -> std::pmr::string {
+                std::pmr::string output(resource);
+                output.resize_and_overwrite(
+                    internal::planned_size(fmt.plan(), args...),
+                    [&](char* data, std::size_t) noexcept {
+                        char* end = internal::write_planned(data, fmt.get(), fmt.plan(), args...);
+                        return static_cast<std::size_t>(end - data);
+                    }
+                );
+                internal::release_bound(output);
+                return output;
+            });
+        }
+    }
+    std::pmr::string output(resource);
+    auto&& exp = make_noexcept<internal::format_to_fn, Policy>(
+        std::back_inserter(output),
+        fmt.std_format_string(),
+        std::forward<Args>(args)...
+    );
+    if (!exp.has_value()) [[unlikely]] {
+        return std::unexpected(std::move(exp).error());
+    }
+    return output;
+}
+
+// std::format_to_n with an unbounded limit reports the size, std::format_to
+// does not. Planned output is written on the stack, then copied through out.
+template<typename Policy, std::output_iterator<const char&> OutIt, typename... Args>
+std::expected<std::size_t, policy_error_t<Policy>>
+format_to(OutIt out, format_string<Args...> fmt, Args&&... args) noexcept
+{
+    if constexpr (internal::fast_format_args<Args...>) {
+        if (fmt.plan().fast && internal::planned_size(fmt.plan(), args...) <= internal::format_stack_size) {
+            char buffer[internal::format_stack_size];
+            const char* end = internal::write_planned(buffer, fmt.get(), fmt.plan(), args...);
+            // out may allocate, back_inserter for one
+            return make_noexcept<Policy>([&]() -> std::size_t {
+                std::copy(static_cast<const char*>(buffer), end, std::move(out));
+                return static_cast<std::size_t>(end - buffer);
+            });
+        }
+    }
+    auto&& exp = make_noexcept<internal::format_to_n_fn, Policy>(
+        std::move(out),
+        std::numeric_limits<std::iter_difference_t<OutIt>>::max(),
+        fmt.std_format_string(),
+        std::forward<Args>(args)...
+    );
+    if (!exp.has_value()) [[unlikely]] {
+        return std::unexpected(std::move(exp).error());
+    }
+    return static_cast<std::size_t>(exp->size);
+}
+
+template<typename Policy, typename... Args>
+std::expected<std::size_t, policy_error_t<Policy>>
+format_to_n(std::span<char> buffer, format_string<Args...> fmt, Args&&... args) noexcept
+{
+    static_assert(
+        error_type<policy_error_t<Policy>>,
+        "format_to_n requires error_traits to report truncation"
+    );
+    if constexpr (internal::fast_format_args<Args...>) {
+        if (fmt.plan().fast) {
+            const std::size_t bound = internal::planned_size(fmt.plan(), args...);
+            if (bound <= buffer.size()) {
+                const char* end = internal::write_planned(buffer.data(), fmt.get(), fmt.plan(), args...);
+                return static_cast<std::size_t>(end - buffer.data());
+            }
+            // The bound does not fit but the output may, truncated output is
+            // written like std::format_to_n does
+            if (bound <= internal::format_stack_size) {
+                char scratch[internal::format_stack_size];
+                const auto size = static_cast<std::size_t>(
+                    internal::write_planned(scratch, fmt.get(), fmt.plan(), args...) - scratch
+                );
+                std::memcpy(buffer.data(), scratch, std::min(size, buffer.size()));
+                if (size > buffer.size()) [[unlikely]] {
+                    return std::unexpected(error_traits<policy_error_t<Policy>>::from_code(errc::truncated));
+                }
+                return size;
+            }
+        }
+    }
+    auto&& exp = make_noexcept<internal::format_to_n_fn, Policy>(
+        buffer.data(),
+        static_cast<std::ptrdiff_t>(buffer.size()),
+        fmt.std_format_string(),
+        std::forward<Args>(args)...
+    );
+    if (!exp.has_value()) [[unlikely]] {
+        return std::unexpected(std::move(exp).error());
+    }
+    auto size = static_cast<std::size_t>(exp->size);
+    if (size > buffer.size()) [[unlikely]] {
+        return std::unexpected(error_traits<policy_error_t<Policy>>::from_code(errc::truncated));
+    }
+    return size;
+}
+
+// The first pass formats into the current capacity and reports the full size.
+// Only when that does not fit is out grown to the exact size and formatted
+// again. std::format_to_n only reads its arguments, so forwarding them to both
+// passes is safe.
+template<typename Policy, typename... Args>
+std::expected<void, policy_error_t<Policy>>
+format_into(std::string& out, format_string<Args...> fmt, Args&&... args) noexcept
 {
-    return make_noexcept<internal::format_ptr<Args...>>(fmt, std::forward<Args>(args)...);
+    if constexpr (internal::fast_format_args<Args...>) {
+        if (fmt.plan().fast) {
+            // Sized up front, allocates only when the bound exceeds the capacity
+            return make_noexcept<Policy>([&]() -> void {
+                out.resize_and_overwrite(
+                    internal::planned_size(fmt.plan(), args...),
+                    [&](char* data, std::size_t) noexcept {
+                        char* end = internal::write_planned(data, fmt.get(), fmt.plan(), args...);
+                        return static_cast<std::size_t>(end - data);
+                    }
+                );
+            });
+        }
+    }
+    using E = policy_error_t<Policy>;
+    std::expected<std::size_t, E> size;
+    auto&& write = [&](char* data, std::size_t capacity) noexcept -> std::size_t {
+        auto&& exp = make_noexcept<internal::format_to_n_fn, Policy>(
+            data,
+            static_cast<std::ptrdiff_t>(capacity),
+            fmt.std_format_string(),
+            std::forward<Args>(args)...
+        );
+        if (!exp.has_value()) [[unlikely]] {
+            size = std::unexpected(std::move(exp).error());
+            return 0;
+        }
+        size = static_cast<std::size_t>(exp->size);
+        return *size <= capacity ? *size : 0;
+    };
+    out.resize_and_overwrite(out.capacity(), write);
+    if (size.has_value() && *size > out.capacity()) [[unlikely]] {
+        auto&& grown = make_noexcept<Policy>([&]() -> void {
+            out.resize_and_overwrite(*size, write);
+        });
+        if (!grown.has_value()) [[unlikely]] {
+            return std::unexpected(std::move(grown).error());
+        }
+    }
+    if (!size.has_value()) [[unlikely]] {
+        return std::unexpected(std::move(size).error());
+    }
+    return std::expected<void, E>();
 }
 
 } // namespace mica
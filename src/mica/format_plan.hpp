@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <mica/type_traits.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace mica {
+
+namespace internal {
+
+// Argument types the fast path of mica::format writes itself. Others,
+// including bool, characters and long double, are left to std::format.
+template<typename T>
+concept fast_format_arg = (std::integral<T> && !std::same_as<T, bool> && !character<T>)
+    || std::same_as<T, float>
+    || std::same_as<T, double>
+    || std::same_as<T, std::string>
+    || std::same_as<T, std::string_view>
+    || std::same_as<T, const char*>
+    || std::same_as<T, char*>;
+
+template<typename... Args>
+concept fast_format_args = (fast_format_arg<std::decay_t<Args>> && ...);
+
+// Plans with more segments are left to std::format
+inline constexpr std::size_t format_plan_capacity = 16;
+
+// A run of literal text of the format string, or a replacement field when
+// arg is not no_arg. "{{" and "}}" are literal segments holding one brace.
+struct format_segment
+{
+    static constexpr std::uint32_t no_arg = ~std::uint32_t(0);
+
+    std::uint32_t begin = 0;
+    std::uint32_t size = 0;
+    std::uint32_t arg = no_arg;
+};
+
+// Format string of N arguments split into segments at compile time. fast is
+// false when the string has format specs or too many segments.
+template<std::size_t N>
+struct format_plan
+{
+    bool fast = false;
+    std::size_t count = 0;
+    std::size_t literal_size = 0;
+    std::array<format_segment, format_plan_capacity> segments{};
+    // Number of fields referring to each argument
+    std::array<std::size_t, N> uses{};
+};
+
+// Expects text to have been checked by std::format_string
+template<std::size_t N>
+consteval format_plan<N> make_format_plan(std::string_view text) noexcept;
+
+// Upper bound of the characters written for value
+template<fast_format_arg T>
+std::size_t max_formatted_size(const T& value) noexcept;
+
+// Writes value at out the way std::format does with an empty format spec,
+// returns the end of the output
+template<fast_format_arg T>
+char* write_format_arg(char* out, const T& value) noexcept;
+
+template<std::integral T>
+char* write_integer(char* out, T value) noexcept;
+
+} // namespace mica::internal
+
+} // namespace mica
+
+#include <mica/format_plan.inl>
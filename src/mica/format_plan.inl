@@ -0,0 +1,160 @@
+#include <charconv>
+#include <cstring>
+#include <limits>
+
+namespace mica {
+
+namespace internal {
+
+template<std::size_t N>
+consteval format_plan<N> make_format_plan(std::string_view text) noexcept
+{
+    format_plan<N> plan;
+    std::size_t next_arg = 0;
+    std::size_t literal_begin = 0;
+    auto add = [&](std::size_t begin, std::size_t size, std::uint32_t arg) {
+        if (arg == format_segment::no_arg && size == 0) {
+            return true;
+        }
+        if (plan.count == format_plan_capacity) {
+            return false;
+        }
+        plan.segments[plan.count++] = format_segment{
+            static_cast<std::uint32_t>(begin),
+            static_cast<std::uint32_t>(size),
+            arg
+        };
+        if (arg == format_segment::no_arg) {
+            plan.literal_size += size;
+        } else {
+            ++plan.uses[arg];
+        }
+        return true;
+    };
+
+    std::size_t i = 0;
+    while (i < text.size()) {
+        const char c = text[i];
+        if (c != '{' && c != '}') {
+            ++i;
+            continue;
+        }
+        // Escaped brace, the first one is kept as literal text
+        if (c == '}' || text[i + 1] == '{') {
+            if (!add(literal_begin, i + 1 - literal_begin, format_segment::no_arg)) {
+                return format_plan<N>();
+            }
+            i += 2;
+            literal_begin = i;
+            continue;
+        }
+        if (!add(literal_begin, i - literal_begin, format_segment::no_arg)) {
+            return format_plan<N>();
+        }
+        std::size_t j = i + 1;
+        std::size_t arg = 0;
+        if (text[j] >= '0' && text[j] <= '9') {
+            while (text[j] >= '0' && text[j] <= '9') {
+                arg = arg * 10 + static_cast<std::size_t>(text[j] - '0');
+                ++j;
+            }
+        } else {
+            arg = next_arg++;
+        }
+        // An empty spec is the default one
+        if (text[j] == ':') {
+            ++j;
+        }
+        if (text[j] != '}') {
+            return format_plan<N>();
+        }
+        if (!add(0, 0, static_cast<std::uint32_t>(arg))) {
+            return format_plan<N>();
+        }
+        i = j + 1;
+        literal_begin = i;
+    }
+    if (!add(literal_begin, text.size() - literal_begin, format_segment::no_arg)) {
+        return format_plan<N>();
+    }
+    plan.fast = true;
+    return plan;
+}
+
+template<fast_format_arg T>
+std::size_t max_formatted_size(const T& value) noexcept
+{
+    if constexpr (std::integral<T>) {
+        // digits10 is one less than the longest value, plus a sign
+        return std::numeric_limits<T>::digits10 + 2;
+    } else if constexpr (std::floating_point<T>) {
+        // Shortest round trip form, e.g. -1.7976931348623157e+308
+        return std::numeric_limits<T>::max_digits10 + 8;
+    } else {
+        return std::string_view(value).size();
+    }
+}
+
+template<fast_format_arg T>
+char* write_format_arg(char* out, const T& value) noexcept
+{
+    if constexpr (std::integral<T>) {
+        return write_integer(out, value);
+    } else if constexpr (std::floating_point<T>) {
+        // Cannot fail, the output was sized by max_formatted_size
+        return std::to_chars(out, out + max_formatted_size(value), value).ptr;
+    } else {
+        const std::string_view text(value);
+        std::memcpy(out, text.data(), text.size());
+        return out + text.size();
+    }
+}
+
+inline constexpr char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Digits are written two at a time from the end of a local buffer, then
+// copied out in one piece
+template<std::integral T>
+char* write_integer(char* out, T value) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    U magnitude = static_cast<U>(value);
+    if constexpr (std::is_signed_v<T>) {
+        if (value < 0) {
+            *out++ = '-';
+            magnitude = static_cast<U>(U(0) - magnitude);
+        }
+    }
+    char buffer[std::numeric_limits<U>::digits10 + 1];
+    char* const end = buffer + sizeof(buffer);
+    char* first = end;
+    while (magnitude >= 100) {
+        const auto pair = static_cast<std::size_t>(magnitude % 100) * 2;
+        magnitude /= 100;
+        first -= 2;
+        std::memcpy(first, digit_pairs + pair, 2);
+    }
+    if (magnitude >= 10) {
+        first -= 2;
+        std::memcpy(first, digit_pairs + static_cast<std::size_t>(magnitude) * 2, 2);
+    } else {
+        *--first = static_cast<char>('0' + magnitude);
+    }
+    const auto length = static_cast<std::size_t>(end - first);
+    std::memcpy(out, first, length);
+    return out + length;
+}
+
+} // namespace mica::internal
+
+} // namespace mica
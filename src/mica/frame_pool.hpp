@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mica {
+
+// Per-thread recycling allocator for coroutine frames. Sizes are rounded up
+// to a size class; a freed frame is cached by the thread that frees it and
+// reused by the next frame of the same class. Frames larger than the biggest
+// class, or freed while the cache of their class is full, go to the global
+// operator new and delete.
+struct frame_pool_policy
+{
+    static constexpr std::size_t granularity = 64;
+    static constexpr std::size_t max_frame_size = 2048;
+    static constexpr std::size_t max_cached_per_class = 64;
+};
+
+namespace internal {
+
+void* allocate_frame(std::size_t size);
+
+void deallocate_frame(void* frame, std::size_t size) noexcept;
+
+} // namespace mica::internal
+
+// Number of frames cached by the calling thread
+std::size_t cached_frames() noexcept;
+
+// Number of frames allocated by the calling thread, from its cache or the
+// heap. Frames whose allocation was elided by the compiler are not counted.
+std::size_t allocated_frames() noexcept;
+
+} // namespace mica
+
+#include <mica/frame_pool.inl>
@@ -0,0 +1,132 @@
+#include <array>
+#include <new>
+
+namespace mica {
+
+namespace internal {
+
+inline constexpr std::size_t frame_class_count =
+    frame_pool_policy::max_frame_size / frame_pool_policy::granularity;
+
+struct free_frame
+{
+    free_frame* next;
+};
+
+class frame_cache {
+public:
+    frame_cache() noexcept = default;
+
+    frame_cache(const frame_cache&) = delete;
+
+    frame_cache& operator=(const frame_cache&) = delete;
+
+    ~frame_cache()
+    {
+        for (std::size_t size_class = 0; size_class < frame_class_count; ++size_class) {
+            while (free_frame* frame = heads_[size_class]) {
+                heads_[size_class] = frame->next;
+                ::operator delete(frame, class_bytes(size_class));
+            }
+        }
+    }
+
+    static constexpr std::size_t class_bytes(std::size_t size_class) noexcept
+    {
+        return (size_class + 1) * frame_pool_policy::granularity;
+    }
+
+    void* pop(std::size_t size_class) noexcept
+    {
+        ++allocated_;
+        free_frame* frame = heads_[size_class];
+        if (frame != nullptr) {
+            heads_[size_class] = frame->next;
+            --counts_[size_class];
+            --cached_;
+        }
+        return frame;
+    }
+
+    bool push(std::size_t size_class, void* memory) noexcept
+    {
+        if (counts_[size_class] >= frame_pool_policy::max_cached_per_class) {
+            return false;
+        }
+        heads_[size_class] = ::new (memory) free_frame{heads_[size_class]};
+        ++counts_[size_class];
+        ++cached_;
+        return true;
+    }
+
+    std::size_t cached() const noexcept
+    {
+        return cached_;
+    }
+
+    void count_uncached() noexcept
+    {
+        ++allocated_;
+    }
+
+    std::size_t allocated() const noexcept
+    {
+        return allocated_;
+    }
+
+private:
+    std::array<free_frame*, frame_class_count> heads_{};
+    std::array<std::size_t, frame_class_count> counts_{};
+    std::size_t cached_ = 0;
+    std::size_t allocated_ = 0;
+};
+
+inline frame_cache& local_frame_cache() noexcept
+{
+    thread_local frame_cache cache;
+    return cache;
+}
+
+constexpr std::size_t frame_class(std::size_t size) noexcept
+{
+    return (size + frame_pool_policy::granularity - 1) / frame_pool_policy::granularity - 1;
+}
+
+inline void* allocate_frame(std::size_t size)
+{
+    if (size == 0 || size > frame_pool_policy::max_frame_size) {
+        local_frame_cache().count_uncached();
+        return ::operator new(size);
+    }
+    const std::size_t size_class = frame_class(size);
+    if (void* frame = local_frame_cache().pop(size_class)) {
+        return frame;
+    }
+    return ::operator new(frame_cache::class_bytes(size_class));
+}
+
+inline void deallocate_frame(void* frame, std::size_t size) noexcept
+{
+    if (size == 0 || size > frame_pool_policy::max_frame_size) {
+        ::operator delete(frame, size);
+        return;
+    }
+    const std::size_t size_class = frame_class(size);
+    if (!local_frame_cache().push(size_class, frame)) {
+        ::operator delete(frame, frame_cache::class_bytes(size_class));
+    }
+}
+
+} // namespace mica::internal
+
+inline std::size_t cached_frames() noexcept
+{
+    return internal::local_frame_cache().cached();
+}
+
+inline std::size_t allocated_frames() noexcept
+{
+    return internal::local_frame_cache().allocated();
+}
+
+} // namespace mica
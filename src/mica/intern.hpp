@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mica/error_traits.hpp>
+#include <string_view>
+
+namespace mica {
+
+// Bounds an intern table so adversarial messages cannot grow it without
+// limit. Messages longer than max_length, or arriving once max_entries
+// messages are stored, are replaced by a shared "dropped" message.
+struct intern_policy
+{
+    static constexpr std::size_t max_entries = 1024;
+    static constexpr std::size_t max_length = 256;
+};
+
+namespace internal {
+
+struct intern_entry
+{
+    std::uint64_t hash;
+    std::string_view text;
+};
+
+inline constexpr intern_entry empty_intern_entry{0, ""};
+
+inline constexpr intern_entry dropped_intern_entry{0, "interned message dropped"};
+
+inline constexpr intern_entry unknown_intern_entry{0, "unexpected error"};
+
+constexpr std::uint64_t intern_hash(std::string_view text) noexcept;
+
+} // namespace mica::internal
+
+// 8 byte handle to a message stored in an intern table. Handles to the same
+// stored message compare equal.
+template<typename Policy = intern_policy>
+class basic_interned {
+public:
+    constexpr basic_interned() noexcept;
+
+    constexpr explicit basic_interned(const internal::intern_entry* entry) noexcept;
+
+    constexpr std::string_view view() const noexcept;
+
+    // True when the message was not stored because of the Policy bounds
+    constexpr bool dropped() const noexcept;
+
+    friend constexpr bool operator==(basic_interned lhs, basic_interned rhs) noexcept = default;
+
+private:
+    const internal::intern_entry* entry_;
+};
+
+using interned = basic_interned<>;
+
+// Concurrent, append-only, open addressing string table. Lookups and inserts
+// are lock-free, stored messages are never freed.
+template<typename Policy = intern_policy>
+class intern_table {
+public:
+    constexpr intern_table() noexcept = default;
+
+    intern_table(const intern_table&) = delete;
+
+    intern_table& operator=(const intern_table&) = delete;
+
+    static intern_table& global() noexcept;
+
+    basic_interned<Policy> intern(std::string_view text) noexcept;
+
+    std::size_t size() const noexcept;
+
+private:
+    static constexpr std::size_t capacity = std::bit_ceil(2 * Policy::max_entries);
+
+    std::array<std::atomic<const internal::intern_entry*>, capacity> slots_{};
+    std::atomic<std::size_t> size_{0};
+};
+
+// Intern text into the global table of Policy
+template<typename Policy = intern_policy>
+basic_interned<Policy> intern(std::string_view text) noexcept;
+
+template<typename Policy>
+struct error_traits<basic_interned<Policy>>
+{
+    static basic_interned<Policy> from_exception(const std::exception& e) noexcept;
+
+    static basic_interned<Policy> from_unknown() noexcept;
+
+    static basic_interned<Policy> from_code(errc code) noexcept;
+
+    static basic_interned<Policy> from_errno(int code) noexcept;
+};
+
+} // namespace mica
+
+#include <mica/intern.inl>
@@ -0,0 +1,144 @@
+#include <cstring>
+#include <new>
+
+namespace mica {
+
+namespace internal {
+
+// 64-bit FNV-1a
+constexpr std::uint64_t intern_hash(std::string_view text) noexcept
+{
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// The entry and its characters share one allocation
+inline const intern_entry* make_intern_entry(std::uint64_t hash, std::string_view text) noexcept
+{
+    void* memory = ::operator new(sizeof(intern_entry) + text.size(), std::nothrow);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    char* data = static_cast<char*>(memory) + sizeof(intern_entry);
+    std::memcpy(data, text.data(), text.size());
+    return ::new (memory) intern_entry{hash, std::string_view(data, text.size())};
+}
+
+inline void destroy_intern_entry(const intern_entry* entry) noexcept
+{
+    ::operator delete(const_cast<intern_entry*>(entry));
+}
+
+} // namespace mica::internal
+
+template<typename Policy>
+constexpr basic_interned<Policy>::basic_interned() noexcept
+    : entry_(&internal::empty_intern_entry)
+{}
+
+template<typename Policy>
+constexpr basic_interned<Policy>::basic_interned(const internal::intern_entry* entry) noexcept
+    : entry_(entry)
+{}
+
+template<typename Policy>
+constexpr std::string_view basic_interned<Policy>::view() const noexcept
+{
+    return entry_->text;
+}
+
+template<typename Policy>
+constexpr bool basic_interned<Policy>::dropped() const noexcept
+{
+    return entry_ == &internal::dropped_intern_entry;
+}
+
+template<typename Policy>
+intern_table<Policy>& intern_table<Policy>::global() noexcept
+{
+    static intern_table table;
+    return table;
+}
+
+template<typename Policy>
+basic_interned<Policy> intern_table<Policy>::intern(std::string_view text) noexcept
+{
+    using internal::intern_entry;
+    const basic_interned<Policy> dropped(&internal::dropped_intern_entry);
+    if (text.size() > Policy::max_length) {
+        return dropped;
+    }
+    const std::uint64_t hash = internal::intern_hash(text);
+    const intern_entry* candidate = nullptr;
+    for (std::size_t probe = 0; probe < capacity; ++probe) {
+        auto& slot = slots_[(hash + probe) & (capacity - 1)];
+        const intern_entry* entry = slot.load(std::memory_order_acquire);
+        if (entry == nullptr) {
+            if (size_.load(std::memory_order_relaxed) >= Policy::max_entries) {
+                break;
+            }
+            if (candidate == nullptr) {
+                candidate = internal::make_intern_entry(hash, text);
+                if (candidate == nullptr) {
+                    return dropped;
+                }
+            }
+            if (slot.compare_exchange_strong(entry, candidate, std::memory_order_acq_rel)) {
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return basic_interned<Policy>(candidate);
+            }
+            // Another thread claimed the slot, entry now holds its value
+        }
+        if (entry->hash == hash && entry->text == text) {
+            internal::destroy_intern_entry(candidate);
+            return basic_interned<Policy>(entry);
+        }
+    }
+    internal::destroy_intern_entry(candidate);
+    return dropped;
+}
+
+template<typename Policy>
+std::size_t intern_table<Policy>::size() const noexcept
+{
+    return size_.load(std::memory_order_relaxed);
+}
+
+template<typename Policy>
+basic_interned<Policy> intern(std::string_view text) noexcept
+{
+    return intern_table<Policy>::global().intern(text);
+}
+
+template<typename Policy>
+basic_interned<Policy> error_traits<basic_interned<Policy>>::from_exception(const std::exception& e) noexcept
+{
+    return intern<Policy>(e.what());
+}
+
+template<typename Policy>
+basic_interned<Policy> error_traits<basic_interned<Policy>>::from_unknown() noexcept
+{
+    return basic_interned<Policy>(&internal::unknown_intern_entry);
+}
+
+template<typename Policy>
+basic_interned<Policy> error_traits<basic_interned<Policy>>::from_code(errc code) noexcept
+{
+    return intern<Policy>(to_string(code));
+}
+
+template<typename Policy>
+basic_interned<Policy> error_traits<basic_interned<Policy>>::from_errno(int code) noexcept
+{
+    if (const char* message = internal::errno_message(code)) {
+        return intern<Policy>(message);
+    }
+    return from_code(errc::system_error);
+}
+
+} // namespace mica
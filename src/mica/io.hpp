@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <mica/error.hpp>
+#include <mica/error_traits.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mica {
+
+namespace io {
+
+// File descriptor opened for reading, closed on destruction
+class file {
+public:
+    constexpr file() noexcept = default;
+
+    // Adopts descriptor
+    constexpr explicit file(int descriptor) noexcept;
+
+    file(const file&) = delete;
+
+    file(file&& other) noexcept;
+
+    file& operator=(const file&) = delete;
+
+    file& operator=(file&& other) noexcept;
+
+    ~file();
+
+    constexpr int descriptor() const noexcept;
+
+    constexpr bool is_open() const noexcept;
+
+private:
+    int descriptor_ = -1;
+};
+
+// How a mapping is going to be read, passed to madvise
+enum class access_pattern {
+    normal,
+    sequential,
+    random,
+    will_need,
+};
+
+// Read-only mapping of a whole file, unmapped on destruction. Empty files
+// are not mapped and give an empty span.
+class mapped_file {
+public:
+    constexpr mapped_file() noexcept = default;
+
+    // Adopts a mapping made with mmap
+    constexpr mapped_file(const void* address, std::size_t size) noexcept;
+
+    mapped_file(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& other) noexcept;
+
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file& operator=(mapped_file&& other) noexcept;
+
+    ~mapped_file();
+
+    std::span<const std::byte> bytes() const noexcept;
+
+    // The bytes as characters, for text parsers
+    std::string_view text() const noexcept;
+
+    constexpr std::size_t size() const noexcept;
+
+    constexpr bool empty() const noexcept;
+
+private:
+    const void* address_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+namespace internal {
+
+// True when building the error of a failed system call cannot throw
+template<error_type E>
+constexpr bool nothrow_errors() noexcept;
+
+} // namespace mica::io::internal
+
+// A failed system call returns the error built by error_traits<E>::from_errno,
+// or from_code(errc::system_error) if E has no from_errno. Errors that can be
+// appended to, like std::string, end with ": " and the path. The functions
+// are noexcept when E is built without allocating, as the default mica::error
+// is; with std::string a std::bad_alloc while reporting an error propagates.
+
+template<error_type E = error>
+std::expected<file, E> open(const std::filesystem::path& path) noexcept(internal::nothrow_errors<E>());
+
+// Files whose size is unknown up front, like /proc entries, map as empty,
+// read them with read_all instead
+template<error_type E = error>
+std::expected<mapped_file, E> map_file(
+    const std::filesystem::path& path,
+    access_pattern pattern = access_pattern::sequential
+) noexcept(internal::nothrow_errors<E>());
+
+// Reads from offset until buffer is full or the file ends, retrying short
+// and interrupted reads. Returns the number of bytes read.
+template<error_type E = error>
+std::expected<std::size_t, E> pread(const file& input, std::span<std::byte> buffer, std::uint64_t offset)
+    noexcept(internal::nothrow_errors<E>());
+
+// Reads the whole file with one read when its size is known, growing the
+// buffer otherwise
+template<error_type E = error>
+std::expected<std::vector<std::byte>, E> read_all(const std::filesystem::path& path)
+    noexcept(internal::nothrow_errors<E>());
+
+} // namespace mica::io
+
+} // namespace mica
+
+#include <mica/io.inl>
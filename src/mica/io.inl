@@ -0,0 +1,279 @@
+#include <cerrno>
+#include <fcntl.h>
+#include <limits>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace mica {
+
+namespace io {
+
+namespace internal {
+
+// Buffer size of the first read of files whose size is unknown
+inline constexpr std::size_t unknown_size_chunk = 4096;
+
+inline int advice(access_pattern pattern) noexcept
+{
+    switch (pattern) {
+    case access_pattern::sequential:
+        return MADV_SEQUENTIAL;
+    case access_pattern::random:
+        return MADV_RANDOM;
+    case access_pattern::will_need:
+        return MADV_WILLNEED;
+    case access_pattern::normal:
+        break;
+    }
+    return MADV_NORMAL;
+}
+
+template<error_type E>
+constexpr bool nothrow_errors() noexcept
+{
+    if constexpr (requires(int code) { error_traits<E>::from_errno(code); }) {
+        return noexcept(error_traits<E>::from_errno(0));
+    } else {
+        return noexcept(error_traits<E>::from_code(errc::system_error));
+    }
+}
+
+template<typename T, error_type E>
+std::expected<T, E> last_error() noexcept(nothrow_errors<E>())
+{
+    return std::unexpected(mica::internal::errno_error<E>(errno));
+}
+
+template<typename E>
+concept appendable_error = requires(E& error, std::string_view text) {
+    error += text;
+};
+
+// The error of code, followed by the path when E can be appended to
+template<error_type E>
+E path_error(int code, const std::filesystem::path& path) noexcept(nothrow_errors<E>())
+{
+    E error = mica::internal::errno_error<E>(code);
+    if constexpr (appendable_error<E>) {
+        error += std::string_view(": ");
+        error += std::string_view(path.native());
+    }
+    return error;
+}
+
+// The status of a file that can be read whole, EISDIR or ENODEV otherwise
+template<error_type E>
+std::expected<std::size_t, E> regular_size(const file& input, const std::filesystem::path& path)
+    noexcept(nothrow_errors<E>())
+{
+    struct stat status;
+    if (::fstat(input.descriptor(), &status) != 0) {
+        return std::unexpected(path_error<E>(errno, path));
+    }
+    if (S_ISDIR(status.st_mode)) {
+        return std::unexpected(path_error<E>(EISDIR, path));
+    }
+    if (!S_ISREG(status.st_mode)) {
+        return std::unexpected(path_error<E>(ENODEV, path));
+    }
+    if constexpr (sizeof(std::size_t) < sizeof(status.st_size)) {
+        if (status.st_size > static_cast<decltype(status.st_size)>(std::numeric_limits<std::size_t>::max())) {
+            return std::unexpected(path_error<E>(EFBIG, path));
+        }
+    }
+    return static_cast<std::size_t>(status.st_size);
+}
+
+} // namespace mica::io::internal
+
+constexpr file::file(int descriptor) noexcept
+    : descriptor_(descriptor)
+{}
+
+inline file::file(file&& other) noexcept
+    : descriptor_(std::exchange(other.descriptor_, -1))
+{}
+
+inline file& file::operator=(file&& other) noexcept
+{
+    if (this != &other) {
+        if (descriptor_ >= 0) {
+            ::close(descriptor_);
+        }
+        descriptor_ = std::exchange(other.descriptor_, -1);
+    }
+    return *this;
+}
+
+// close is not retried on EINTR, the descriptor is released either way
+inline file::~file()
+{
+    if (descriptor_ >= 0) {
+        ::close(descriptor_);
+    }
+}
+
+constexpr int file::descriptor() const noexcept
+{
+    return descriptor_;
+}
+
+constexpr bool file::is_open() const noexcept
+{
+    return descriptor_ >= 0;
+}
+
+constexpr mapped_file::mapped_file(const void* address, std::size_t size) noexcept
+    : address_(address),
+      size_(size)
+{}
+
+inline mapped_file::mapped_file(mapped_file&& other) noexcept
+    : address_(std::exchange(other.address_, nullptr)),
+      size_(std::exchange(other.size_, 0))
+{}
+
+inline mapped_file& mapped_file::operator=(mapped_file&& other) noexcept
+{
+    if (this != &other) {
+        if (address_ != nullptr) {
+            ::munmap(const_cast<void*>(address_), size_);
+        }
+        address_ = std::exchange(other.address_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+inline mapped_file::~mapped_file()
+{
+    if (address_ != nullptr) {
+        ::munmap(const_cast<void*>(address_), size_);
+    }
+}
+
+inline std::span<const std::byte> mapped_file::bytes() const noexcept
+{
+    return std::span<const std::byte>(static_cast<const std::byte*>(address_), size_);
+}
+
+inline std::string_view mapped_file::text() const noexcept
+{
+    return std::string_view(static_cast<const char*>(address_), size_);
+}
+
+constexpr std::size_t mapped_file::size() const noexcept
+{
+    return size_;
+}
+
+constexpr bool mapped_file::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+template<error_type E>
+std::expected<file, E> open(const std::filesystem::path& path) noexcept(internal::nothrow_errors<E>())
+{
+    int descriptor;
+    do {
+        descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    } while (descriptor < 0 && errno == EINTR);
+    if (descriptor < 0) {
+        return std::unexpected(internal::path_error<E>(errno, path));
+    }
+    return file(descriptor);
+}
+
+template<error_type E>
+std::expected<mapped_file, E> map_file(const std::filesystem::path& path, access_pattern pattern)
+    noexcept(internal::nothrow_errors<E>())
+{
+    auto&& input = io::open<E>(path);
+    if (!input.has_value()) {
+        return std::unexpected(std::move(input).error());
+    }
+    auto&& size = internal::regular_size<E>(*input, path);
+    if (!size.has_value()) {
+        return std::unexpected(std::move(size).error());
+    }
+    if (*size == 0) {
+        return mapped_file();
+    }
+    void* address = ::mmap(nullptr, *size, PROT_READ, MAP_PRIVATE, input->descriptor(), 0);
+    if (address == MAP_FAILED) {
+        return std::unexpected(internal::path_error<E>(errno, path));
+    }
+    // Only a hint, the mapping is usable if the kernel ignores it
+    ::madvise(address, *size, internal::advice(pattern));
+    return mapped_file(address, *size);
+}
+
+template<error_type E>
+std::expected<std::size_t, E> pread(const file& input, std::span<std::byte> buffer, std::uint64_t offset)
+    noexcept(internal::nothrow_errors<E>())
+{
+    std::size_t total = 0;
+    while (total < buffer.size()) {
+        const ::ssize_t count = ::pread(
+            input.descriptor(),
+            buffer.data() + total,
+            buffer.size() - total,
+            static_cast<::off_t>(offset + total)
+        );
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return internal::last_error<std::size_t, E>();
+        }
+        if (count == 0) {
+            break;
+        }
+        total += static_cast<std::size_t>(count);
+    }
+    return total;
+}
+
+template<error_type E>
+std::expected<std::vector<std::byte>, E> read_all(const std::filesystem::path& path)
+    noexcept(internal::nothrow_errors<E>())
+{
+    auto&& input = io::open<E>(path);
+    if (!input.has_value()) {
+        return std::unexpected(std::move(input).error());
+    }
+    auto&& size = internal::regular_size<E>(*input, path);
+    if (!size.has_value()) {
+        return std::unexpected(std::move(size).error());
+    }
+    // One byte more than the known size, so a file that grew is noticed
+    std::size_t capacity = *size == 0 ? internal::unknown_size_chunk : *size + 1;
+    std::vector<std::byte> output;
+    std::size_t length = 0;
+    try {
+        while (true) {
+            output.resize(capacity);
+            auto&& count = io::pread<E>(*input, std::span(output).subspan(length), length);
+            if (!count.has_value()) {
+                return std::unexpected(std::move(count).error());
+            }
+            length += *count;
+            if (length < capacity) {
+                break;
+            }
+            capacity *= 2;
+        }
+    } catch (const std::bad_alloc&) {
+        return std::unexpected(internal::path_error<E>(ENOMEM, path));
+    }
+    output.resize(length);
+    return output;
+}
+
+} // namespace mica::io
+
+} // namespace mica
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mica/call_site.hpp>
+#include <mica/per_thread.hpp>
+#include <mica/policy.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Timing is compiled in only when MICA_LATENCY is 1. When it is 0, timed
+// policies behave exactly like the policy they wrap.
+#ifndef MICA_LATENCY
+#define MICA_LATENCY 0
+#endif
+
+namespace mica {
+
+// Shape of the latency histograms. Every power of two is split into
+// 2^sub_bucket_bits buckets, bounding the relative error of a recorded
+// latency to 2^-sub_bucket_bits. Latencies of 2^max_latency_bits ns or more
+// fall into the last bucket.
+struct latency_policy
+{
+    static constexpr std::size_t sub_bucket_bits = 3;
+    static constexpr std::size_t max_latency_bits = 36;
+};
+
+namespace internal {
+
+inline constexpr std::size_t latency_sub_buckets = std::size_t(1) << latency_policy::sub_bucket_bits;
+
+inline constexpr std::size_t latency_bucket_count =
+    (latency_policy::max_latency_bits - latency_policy::sub_bucket_bits + 1) * latency_sub_buckets;
+
+constexpr std::size_t latency_bucket(std::uint64_t nanoseconds) noexcept;
+
+// Highest latency in ns that falls into bucket
+constexpr std::uint64_t latency_bucket_limit(std::size_t bucket) noexcept;
+
+} // namespace mica::internal
+
+// Log-bucketed latency histogram, in the style of HdrHistogram
+class latency_histogram {
+public:
+    static constexpr std::size_t bucket_count = internal::latency_bucket_count;
+
+    constexpr latency_histogram() noexcept = default;
+
+    void record(std::chrono::nanoseconds latency, std::uint64_t count = 1) noexcept;
+
+    void merge(const latency_histogram& other) noexcept;
+
+    std::uint64_t count() const noexcept;
+
+    // Latency not exceeded by the given fraction of the recorded calls, for
+    // example 0.99 for p99. Reports the highest latency of the bucket it
+    // falls in, zero when nothing was recorded.
+    std::chrono::nanoseconds percentile(double fraction) const noexcept;
+
+    std::chrono::nanoseconds max() const noexcept;
+
+    std::uint64_t bucket(std::size_t index) const noexcept;
+
+private:
+    std::array<std::uint64_t, bucket_count> buckets_{};
+    std::uint64_t count_ = 0;
+};
+
+namespace internal {
+
+// Written only by the owning thread, read by snapshots
+struct alignas(64) site_latencies
+{
+    std::array<std::atomic<std::uint64_t>, latency_bucket_count> success;
+    std::array<std::atomic<std::uint64_t>, latency_bucket_count> failure;
+};
+
+// Histograms of a site are allocated the first time the thread times it
+struct latency_block
+{
+    latency_block() noexcept = default;
+
+    latency_block(const latency_block&) = delete;
+
+    latency_block& operator=(const latency_block&) = delete;
+
+    ~latency_block();
+
+    site_latencies* site(std::size_t index) noexcept;
+
+    void merge(const latency_block& other) noexcept;
+
+    std::array<std::atomic<site_latencies*>, call_site_policy::max_sites> sites{};
+    latency_block* previous = nullptr;
+    latency_block* next = nullptr;
+};
+
+template<typename Site>
+void record_latency(bool failed, std::chrono::nanoseconds latency) noexcept;
+
+// Times a call from its construction to its destruction, so failures include
+// the catch handler and the construction of the error
+template<typename Site>
+class timing_observer {
+public:
+    timing_observer() noexcept;
+
+    timing_observer(const timing_observer&) = delete;
+
+    timing_observer& operator=(const timing_observer&) = delete;
+
+    ~timing_observer();
+
+    void success() noexcept;
+
+    void failure() noexcept;
+
+private:
+    std::chrono::steady_clock::time_point start_;
+    bool failed_ = false;
+};
+
+} // namespace mica::internal
+
+// Wraps an error policy and records the latency of every call of one call
+// site, in separate histograms for successes and failures, see
+// MICA_CALL_SITE:
+//     make_noexcept<parse, mica::timed<std::string, MICA_CALL_SITE>>(text);
+template<error_policy Policy, typename Site>
+struct timed
+{};
+
+template<error_policy Policy, typename Site>
+struct policy_traits<timed<Policy, Site>>
+{
+    using error_type = policy_error_t<Policy>;
+    using handlers = typename policy_traits<Policy>::handlers;
+    using fallback = internal::policy_fallback_t<Policy>;
+#if MICA_LATENCY
+    using observer = internal::chain_observers_t<
+        internal::policy_observer_t<Policy>,
+        internal::timing_observer<Site>
+    >;
+#else
+    using observer = internal::policy_observer_t<Policy>;
+#endif
+};
+
+struct call_site_latencies
+{
+    std::uint64_t id;
+    std::string_view file;
+    std::uint32_t line;
+    latency_histogram success;
+    latency_histogram failure;
+};
+
+// Histograms of every call site, merged across the live threads and the
+// threads that exited. Sites that were never timed have empty histograms.
+struct latency_snapshot
+{
+    std::vector<call_site_latencies> sites;
+};
+
+latency_snapshot snapshot_latencies();
+
+// One line per call site and outcome with its count, p50, p99, p999 and max
+std::string to_string(const latency_snapshot& snapshot);
+
+std::string to_json(const latency_snapshot& snapshot);
+
+} // namespace mica
+
+#include <mica/latency.inl>
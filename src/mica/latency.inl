@@ -0,0 +1,273 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <new>
+
+namespace mica {
+
+namespace internal {
+
+// Latencies below 2 * latency_sub_buckets ns have a bucket each. Above, the
+// bucket is given by the bit width and the sub_bucket_bits bits below the
+// leading one.
+constexpr std::size_t latency_bucket(std::uint64_t nanoseconds) noexcept
+{
+    if (nanoseconds < latency_sub_buckets) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+    const std::size_t width = std::bit_width(nanoseconds);
+    if (width > latency_policy::max_latency_bits) {
+        return latency_bucket_count - 1;
+    }
+    const std::size_t shift = width - latency_policy::sub_bucket_bits - 1;
+    return shift * latency_sub_buckets + static_cast<std::size_t>(nanoseconds >> shift);
+}
+
+constexpr std::uint64_t latency_bucket_limit(std::size_t bucket) noexcept
+{
+    if (bucket < 2 * latency_sub_buckets) {
+        return bucket;
+    }
+    const std::size_t shift = bucket / latency_sub_buckets - 1;
+    const std::uint64_t top = bucket % latency_sub_buckets + latency_sub_buckets;
+    return ((top + 1) << shift) - 1;
+}
+
+} // namespace mica::internal
+
+inline void latency_histogram::record(std::chrono::nanoseconds latency, std::uint64_t count) noexcept
+{
+    const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+    buckets_[internal::latency_bucket(nanoseconds)] += count;
+    count_ += count;
+}
+
+inline void latency_histogram::merge(const latency_histogram& other) noexcept
+{
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+}
+
+inline std::uint64_t latency_histogram::count() const noexcept
+{
+    return count_;
+}
+
+inline std::chrono::nanoseconds latency_histogram::percentile(double fraction) const noexcept
+{
+    if (count_ == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+    const double rank = std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(count_));
+    const std::uint64_t target = std::max<std::uint64_t>(static_cast<std::uint64_t>(rank), 1);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+        seen += buckets_[i];
+        if (seen >= target) {
+            return std::chrono::nanoseconds(internal::latency_bucket_limit(i));
+        }
+    }
+    return max();
+}
+
+inline std::chrono::nanoseconds latency_histogram::max() const noexcept
+{
+    for (std::size_t i = bucket_count; i > 0; --i) {
+        if (buckets_[i - 1] != 0) {
+            return std::chrono::nanoseconds(internal::latency_bucket_limit(i - 1));
+        }
+    }
+    return std::chrono::nanoseconds(0);
+}
+
+inline std::uint64_t latency_histogram::bucket(std::size_t index) const noexcept
+{
+    return buckets_[index];
+}
+
+namespace internal {
+
+inline void add_latency(std::atomic<std::uint64_t>& bucket, std::uint64_t count) noexcept
+{
+    bucket.store(bucket.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+}
+
+inline latency_block::~latency_block()
+{
+    for (auto& site : sites) {
+        delete site.load(std::memory_order_relaxed);
+    }
+}
+
+// Only the owning thread allocates, the release store publishes the zeroed
+// histograms to snapshots
+inline site_latencies* latency_block::site(std::size_t index) noexcept
+{
+    site_latencies* latencies = sites[index].load(std::memory_order_relaxed);
+    if (latencies == nullptr) [[unlikely]] {
+        latencies = new (std::nothrow) site_latencies{};
+        sites[index].store(latencies, std::memory_order_release);
+    }
+    return latencies;
+}
+
+inline void latency_block::merge(const latency_block& other) noexcept
+{
+    for (std::size_t index = 0; index < call_site_policy::max_sites; ++index) {
+        const site_latencies* from = other.sites[index].load(std::memory_order_acquire);
+        if (from == nullptr) {
+            continue;
+        }
+        site_latencies* into = site(index);
+        if (into == nullptr) {
+            continue;
+        }
+        for (std::size_t i = 0; i < latency_bucket_count; ++i) {
+            add_latency(into->success[i], from->success[i].load(std::memory_order_relaxed));
+            add_latency(into->failure[i], from->failure[i].load(std::memory_order_relaxed));
+        }
+    }
+}
+
+template<typename Site>
+void record_latency(bool failed, std::chrono::nanoseconds latency) noexcept
+{
+    const std::size_t index = site_index<Site>();
+    latency_block* block = local_block<latency_block>();
+    if (index == no_site || block == nullptr) [[unlikely]] {
+        return;
+    }
+    site_latencies* latencies = block->site(index);
+    if (latencies == nullptr) [[unlikely]] {
+        return;
+    }
+    const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+    auto& buckets = failed ? latencies->failure : latencies->success;
+    add_latency(buckets[latency_bucket(nanoseconds)], 1);
+}
+
+template<typename Site>
+timing_observer<Site>::timing_observer() noexcept
+    : start_(std::chrono::steady_clock::now())
+{}
+
+template<typename Site>
+timing_observer<Site>::~timing_observer()
+{
+    record_latency<Site>(failed_, std::chrono::steady_clock::now() - start_);
+}
+
+template<typename Site>
+void timing_observer<Site>::success() noexcept
+{}
+
+template<typename Site>
+void timing_observer<Site>::failure() noexcept
+{
+    failed_ = true;
+}
+
+inline void append_latency_json(std::string& output, const latency_histogram& histogram)
+{
+    output += "{\"count\":";
+    output += std::to_string(histogram.count());
+    output += ",\"p50\":";
+    output += std::to_string(histogram.percentile(0.5).count());
+    output += ",\"p99\":";
+    output += std::to_string(histogram.percentile(0.99).count());
+    output += ",\"p999\":";
+    output += std::to_string(histogram.percentile(0.999).count());
+    output += ",\"max\":";
+    output += std::to_string(histogram.max().count());
+    output += '}';
+}
+
+inline void append_latency_line(std::string& output, const call_site_latencies& site, const char* outcome, const latency_histogram& histogram)
+{
+    output += site.file;
+    output += ':';
+    output += std::to_string(site.line);
+    output += ' ';
+    output += outcome;
+    output += " count ";
+    output += std::to_string(histogram.count());
+    output += " p50 ";
+    output += std::to_string(histogram.percentile(0.5).count());
+    output += "ns p99 ";
+    output += std::to_string(histogram.percentile(0.99).count());
+    output += "ns p999 ";
+    output += std::to_string(histogram.percentile(0.999).count());
+    output += "ns max ";
+    output += std::to_string(histogram.max().count());
+    output += "ns\n";
+}
+
+} // namespace mica::internal
+
+inline latency_snapshot snapshot_latencies()
+{
+    using namespace internal;
+    const std::vector<site_info> sites = registered_sites();
+    latency_snapshot output;
+    output.sites.reserve(sites.size());
+    for (const site_info& info : sites) {
+        output.sites.push_back(call_site_latencies{info.id, info.file, info.line, {}, {}});
+    }
+    block_registry<latency_block>::global().visit([&](const latency_block& block) {
+        for (std::size_t index = 0; index < sites.size(); ++index) {
+            const site_latencies* latencies = block.sites[index].load(std::memory_order_acquire);
+            if (latencies == nullptr) {
+                continue;
+            }
+            call_site_latencies& site = output.sites[index];
+            for (std::size_t i = 0; i < latency_bucket_count; ++i) {
+                const auto limit = std::chrono::nanoseconds(latency_bucket_limit(i));
+                if (const std::uint64_t count = latencies->success[i].load(std::memory_order_relaxed)) {
+                    site.success.record(limit, count);
+                }
+                if (const std::uint64_t count = latencies->failure[i].load(std::memory_order_relaxed)) {
+                    site.failure.record(limit, count);
+                }
+            }
+        }
+    });
+    return output;
+}
+
+inline std::string to_string(const latency_snapshot& snapshot)
+{
+    std::string output;
+    for (const call_site_latencies& site : snapshot.sites) {
+        if (site.success.count() != 0) {
+            internal::append_latency_line(output, site, "success", site.success);
+        }
+        if (site.failure.count() != 0) {
+            internal::append_latency_line(output, site, "failure", site.failure);
+        }
+    }
+    return output;
+}
+
+inline std::string to_json(const latency_snapshot& snapshot)
+{
+    std::string output = "{\"sites\":[";
+    for (std::size_t i = 0; i < snapshot.sites.size(); ++i) {
+        const call_site_latencies& site = snapshot.sites[i];
+        if (i != 0) {
+            output += ',';
+        }
+        output += '{';
+        internal::append_site_json(output, internal::site_info{site.id, site.file, site.line});
+        output += ",\"success\":";
+        internal::append_latency_json(output, site.success);
+        output += ",\"failure\":";
+        internal::append_latency_json(output, site.failure);
+        output += '}';
+    }
+    output += "]}";
+    return output;
+}
+
+} // namespace mica
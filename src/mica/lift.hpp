@@ -0,0 +1,31 @@
+#pragma once
+
+#include <utility>
+
+// A stateless function object calling name_, usable where make_noexcept
+// takes a function. Overload resolution happens at each call as if name_
+// was called directly, so overload sets, function templates and functions
+// with default arguments need no signature, and the call is not made
+// through a function pointer:
+//     make_noexcept<MICA_LIFT(std::stoi)>(text);
+// Unqualified names are also found by argument dependent lookup. Only
+// macros are defined here, code importing the mica module includes it too.
+#define MICA_LIFT(name_) \
+    [](auto&&... args_) \
+        noexcept(noexcept(name_(std::forward<decltype(args_)>(args_)...))) \
+        -> decltype(name_(std::forward<decltype(args_)>(args_)...)) \
+    { \
+        return name_(std::forward<decltype(args_)>(args_)...); \
+    }
+
+// Like MICA_LIFT for the member function overload set name_, called on the
+// first argument. The first argument is an object or a reference, not a
+// pointer:
+//     make_noexcept<MICA_LIFT_MEMBER(substr)>(text, 1, 2);
+#define MICA_LIFT_MEMBER(name_) \
+    [](auto&& obj_, auto&&... args_) \
+        noexcept(noexcept(std::forward<decltype(obj_)>(obj_).name_(std::forward<decltype(args_)>(args_)...))) \
+        -> decltype(std::forward<decltype(obj_)>(obj_).name_(std::forward<decltype(args_)>(args_)...)) \
+    { \
+        return std::forward<decltype(obj_)>(obj_).name_(std::forward<decltype(args_)>(args_)...); \
+    }
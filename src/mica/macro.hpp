@@ -9,3 +9,10 @@
 #define MICA_TMP_VAR_PREFIX _temporary__variable__
 
 #define MICA_TMP_VAR_DEFAULT MICA_TMP_VAR(MICA_TMP_VAR_PREFIX)
+
+// Unique within the translation unit, for temporaries declared in the
+// enclosing scope where several expansions may share a line
+#define MICA_TMP_VAR_UNIQUE MICA_CONCAT(MICA_TMP_VAR_PREFIX, __COUNTER__)
+
+// Identifies the call site it is expanded at, see mica/call_site.hpp
+#define MICA_CALL_SITE ::mica::call_site<__FILE__, __LINE__>
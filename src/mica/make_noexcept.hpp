@@ -2,35 +2,40 @@
 
 #include <concepts>
 #include <expected>
+#include <mica/policy.hpp>
+#include <mica/type_traits.hpp>
 #include <string>
 
 namespace mica {
 
 // Handle free functions
-template<auto Func, typename... Args>
+template<auto Func, typename Policy = std::string, typename... Args>
 requires(
     std::invocable<decltype(Func), Args...>
+    && error_policy<Policy>
 )
 constexpr
-std::expected<std::invoke_result_t<decltype(Func), Args...>, std::string>
+std::expected<std::invoke_result_t<decltype(Func), Args...>, policy_error_t<Policy>>
 make_noexcept(Args&&... args) noexcept;
 
 // Handle member function pointers
-template<auto Func, typename T, typename... Args>
+template<auto Func, typename Policy = std::string, typename T, typename... Args>
 requires (
     std::invocable<decltype(Func), T&&, Args&&...>
+    && error_policy<Policy>
 )
 constexpr
-std::expected<std::invoke_result_t<decltype(Func), T&&, Args&&...>, std::string>
+std::expected<std::invoke_result_t<decltype(Func), T&&, Args&&...>, policy_error_t<Policy>>
 make_noexcept(T&& obj, Args&&... args) noexcept;
 
 // Handle capturing lambdas
-template<typename Lambda, typename... Args>
+template<typename Policy = std::string, typename Lambda, typename... Args>
 requires(
     std::invocable<Lambda, Args&&...>
+    && error_policy<Policy>
 )
 constexpr
-std::expected<std::invoke_result_t<Lambda, Args&&...>, std::string>
+std::expected<std::invoke_result_t<Lambda, Args&&...>, policy_error_t<Policy>>
 make_noexcept(Lambda&& lambda, Args&&... args) noexcept;
 
 } // namespace mica
@@ -7,67 +7,60 @@
 namespace mica {
 
 // Handle free functions
-template<auto Func, typename... Args>
+template<auto Func, typename Policy, typename... Args>
 requires(
     std::invocable<decltype(Func), Args...>
+    && error_policy<Policy>
 )
 constexpr
-std::expected<std::invoke_result_t<decltype(Func), Args...>, std::string>
+std::expected<std::invoke_result_t<decltype(Func), Args...>, policy_error_t<Policy>>
 make_noexcept(Args&&... args) noexcept
 {
     static_assert(
         !std::is_nothrow_invocable_v<decltype(Func), Args...>,
         "It is unnecessary to wrap a noexcept function with make_noexcept"
     );
+    static_assert(
+        !internal::throwing_accessor<Func>::value,
+        "Use mica::get or mica::any_cast from mica/checked.hpp, they check instead of throwing"
+    );
     using R = std::invoke_result_t<decltype(Func), Args...>;
-    try {
-        if constexpr (std::is_void_v<R>) {
-            std::invoke(Func, std::forward<Args>(args)...);
-            return std::expected<R, std::string>();
-        } else {
-            return std::invoke(Func, std::forward<Args>(args)...);
-        }
-    } catch (const std::exception& e) {
-        return std::unexpected(e.what());
-    } catch (...) {
-        return std::unexpected("unexpected error");
-    }
+    return internal::guard<Policy, R>([&]() -> R {
+        return std::invoke(Func, std::forward<Args>(args)...);
+    });
 }
 
 // Handle member function pointers
-template<auto Func, typename T, typename... Args>
+template<auto Func, typename Policy, typename T, typename... Args>
 requires (
     std::invocable<decltype(Func), T&&, Args&&...>
+    && error_policy<Policy>
 )
 constexpr
-std::expected<std::invoke_result_t<decltype(Func), T&&, Args&&...>, std::string>
+std::expected<std::invoke_result_t<decltype(Func), T&&, Args&&...>, policy_error_t<Policy>>
 make_noexcept(T&& obj, Args&&... args) noexcept
 {
     static_assert(
         !std::is_nothrow_invocable_v<decltype(Func), T&&, Args&&...>,
         "It is unnecessary to wrap a noexcept member function with make_noexcept"
     );
+    static_assert(
+        !internal::throwing_accessor<Func>::value,
+        "Use mica::at or mica::value from mica/checked.hpp, they check instead of throwing"
+    );
     using R = std::invoke_result_t<decltype(Func), T&&, Args&&...>;
-    try {
-        if constexpr (std::is_void_v<R>) {
-            std::invoke(Func, std::forward<T>(obj), std::forward<Args>(args)...);
-            return std::expected<R, std::string>();
-        } else {
-            return std::invoke(Func, std::forward<T>(obj), std::forward<Args>(args)...);
-        }
-    } catch (const std::exception& e) {
-        return std::unexpected(e.what());
-    } catch (...) {
-        return std::unexpected("unexpected error");
-    }
+    return internal::guard<Policy, R>([&]() -> R {
+        return std::invoke(Func, std::forward<T>(obj), std::forward<Args>(args)...);
+    });
 }
 
-template<typename Lambda, typename... Args>
+template<typename Policy, typename Lambda, typename... Args>
 requires(
     std::invocable<Lambda, Args&&...>
+    && error_policy<Policy>
 )
 constexpr
-std::expected<std::invoke_result_t<Lambda, Args&&...>, std::string>
+std::expected<std::invoke_result_t<Lambda, Args&&...>, policy_error_t<Policy>>
 make_noexcept(Lambda&& lambda, Args&&... args) noexcept
 {
     static_assert(
@@ -75,18 +68,9 @@ make_noexcept(Lambda&& lambda, Args&&... args) noexcept
         "It is unnecessary to wrap a noexcept lambda with make_noexcept"
     );
     using R = std::invoke_result_t<Lambda, Args&&...>;
-    try {
-        if constexpr (std::is_void_v<R>) {
-            std::invoke(std::forward<Lambda>(lambda), std::forward<Args>(args)...);
-            return std::expected<R, std::string>();
-        } else {
-            return std::invoke(std::forward<Lambda>(lambda), std::forward<Args>(args)...);
-        }
-    } catch (const std::exception& e) {
-        return std::unexpected(e.what());
-    } catch (...) {
-        return std::unexpected("unexpected error");
-    }
+    return internal::guard<Policy, R>([&]() -> R {
+        return std::invoke(std::forward<Lambda>(lambda), std::forward<Args>(args)...);
+    });
 }
 
 } // namespace mica
@@ -0,0 +1,178 @@
+// Module interface of mica, built by the mica::module target when
+// MICA_MODULE is on. Importers see the declarations of mica/mica.hpp, parsed
+// once into the module instead of once per translation unit. Macros cannot
+// be exported, the MICA_TRY and MICA_LIFT macros come from headers of macros
+// only:
+//     #include <mica/lift.hpp>
+//     #include <mica/try_macros.hpp>
+//     import mica;
+
+module;
+
+#include <mica/mica.hpp>
+
+export module mica;
+
+export namespace mica {
+
+// allocator.hpp
+using mica::allocation_policy;
+using mica::allocator_delete;
+using mica::emergency_allocator;
+using mica::emergency_pool;
+using mica::heap_allocator;
+using mica::try_allocator;
+using mica::try_new;
+using mica::try_ptr;
+
+// arena.hpp
+using mica::current_resource;
+using mica::scoped_arena;
+using mica::scoped_resource;
+
+// call_site.hpp
+using mica::call_site;
+using mica::call_site_policy;
+
+// checked.hpp
+using mica::any_cast;
+using mica::at;
+using mica::get;
+using mica::value;
+
+// context.hpp
+using mica::add_context;
+using mica::context_chain;
+using mica::context_frame;
+using mica::is_with_context;
+using mica::is_with_context_v;
+using mica::with_context;
+
+// counters.hpp
+using mica::call_site_counters;
+using mica::counted;
+using mica::counter_policy;
+using mica::counter_snapshot;
+using mica::exception_count;
+using mica::snapshot_counters;
+
+// errc.hpp, to_string and to_json are overloaded by several headers
+using mica::errc;
+using mica::to_json;
+using mica::to_string;
+
+// error.hpp
+using mica::error;
+using mica::error_category;
+
+// error_traits.hpp
+using mica::error_traits;
+using mica::error_type;
+
+// executor.hpp
+using mica::run_loop;
+using mica::thread_executor;
+
+// format.hpp
+using mica::basic_format_string;
+using mica::format;
+using mica::format_into;
+using mica::format_string;
+using mica::format_to;
+using mica::format_to_n;
+
+// frame_pool.hpp
+using mica::allocated_frames;
+using mica::cached_frames;
+using mica::frame_pool_policy;
+
+// intern.hpp
+using mica::basic_interned;
+using mica::intern;
+using mica::intern_policy;
+using mica::intern_table;
+using mica::interned;
+
+// latency.hpp
+using mica::call_site_latencies;
+using mica::latency_histogram;
+using mica::latency_policy;
+using mica::latency_snapshot;
+using mica::snapshot_latencies;
+using mica::timed;
+
+// make_noexcept.hpp
+using mica::make_noexcept;
+
+// parallel.hpp
+using mica::failure_mode;
+using mica::parallel_transform_noexcept;
+
+// parse.hpp
+using mica::parsable;
+using mica::parse;
+using mica::parse_column;
+
+// policy.hpp
+using mica::error_policy;
+using mica::on;
+using mica::otherwise;
+using mica::policy_error_t;
+using mica::policy_traits;
+using mica::translators;
+
+// resolve.hpp
+using mica::resolve;
+
+// result.hpp
+using mica::result;
+
+// sampling.hpp
+using mica::one_in;
+using mica::rate_limited;
+using mica::sampled;
+
+// task.hpp
+using mica::sync_wait;
+using mica::task;
+
+// thread_pool.hpp
+using mica::thread_pool;
+
+// transform.hpp
+using mica::columnar_result;
+using mica::indexed_error;
+using mica::transform_chunk_size;
+using mica::transform_noexcept;
+
+// try_vector.hpp
+using mica::try_vector;
+
+// type_traits.hpp
+using mica::is_expected;
+using mica::is_expected_v;
+using mica::is_string_literal;
+using mica::is_string_literal_v;
+
+} // namespace mica
+
+export namespace mica::io {
+
+// io.hpp
+using mica::io::access_pattern;
+using mica::io::file;
+using mica::io::map_file;
+using mica::io::mapped_file;
+using mica::io::open;
+using mica::io::pread;
+using mica::io::read_all;
+
+} // namespace mica::io
+
+export namespace mica::internal {
+
+// Named by the expansions of the MICA_TRY macros
+using mica::internal::count_call;
+using mica::internal::propagate_context;
+
+} // namespace mica::internal
@@ -1,4 +1,28 @@
+#include <mica/allocator.hpp>
+#include <mica/arena.hpp>
+#include <mica/call_site.hpp>
+#include <mica/checked.hpp>
+#include <mica/context.hpp>
+#include <mica/counters.hpp>
+#include <mica/errc.hpp>
+#include <mica/error.hpp>
+#include <mica/error_traits.hpp>
+#include <mica/executor.hpp>
 #include <mica/format.hpp>
+#include <mica/frame_pool.hpp>
+#include <mica/intern.hpp>
+#include <mica/io.hpp>
+#include <mica/latency.hpp>
+#include <mica/lift.hpp>
 #include <mica/make_noexcept.hpp>
+#include <mica/parallel.hpp>
+#include <mica/parse.hpp>
+#include <mica/policy.hpp>
 #include <mica/resolve.hpp>
+#include <mica/result.hpp>
+#include <mica/sampling.hpp>
+#include <mica/task.hpp>
+#include <mica/thread_pool.hpp>
+#include <mica/transform.hpp>
 #include <mica/try.hpp>
+#include <mica/try_vector.hpp>
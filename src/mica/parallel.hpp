@@ -0,0 +1,47 @@
+#pragma once
+
+#include <concepts>
+#include <expected>
+#include <mica/policy.hpp>
+#include <mica/thread_pool.hpp>
+#include <mica/transform.hpp>
+#include <ranges>
+#include <string>
+
+namespace mica {
+
+// What parallel_transform_noexcept does when an element fails
+enum class failure_mode {
+    // Record every failure in the output and keep going
+    collect,
+    // Skip chunks that have not started yet and return the failure with the
+    // lowest index among those recorded
+    cancel,
+};
+
+// Parallel transform_noexcept: chunks of transform_chunk_size elements run
+// on the workers of pool, each chunk inside a single try region. With
+// failure_mode::cancel, output is restored to its previous size on failure.
+template<
+    auto Func,
+    typename Policy = std::string,
+    std::ranges::random_access_range R,
+    typename T
+>
+requires (
+    std::ranges::sized_range<R>
+    && std::invocable<decltype(Func), std::ranges::range_reference_t<R>>
+    && error_policy<Policy>
+    && std::default_initializable<T>
+    && std::assignable_from<T&, std::invoke_result_t<decltype(Func), std::ranges::range_reference_t<R>>>
+)
+std::expected<void, policy_error_t<Policy>> parallel_transform_noexcept(
+    R&& input,
+    columnar_result<T, policy_error_t<Policy>>& output,
+    thread_pool& pool,
+    failure_mode mode = failure_mode::collect
+) noexcept;
+
+} // namespace mica
+
+#include <mica/parallel.inl>
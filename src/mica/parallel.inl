@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace mica {
+
+namespace internal {
+
+template<typename E>
+struct chunk_failures
+{
+    std::vector<indexed_error<E>> errors;
+    // Set when errors itself could not grow
+    std::optional<E> fatal;
+};
+
+} // namespace mica::internal
+
+template<auto Func, typename Policy, std::ranges::random_access_range R, typename T>
+requires (
+    std::ranges::sized_range<R>
+    && std::invocable<decltype(Func), std::ranges::range_reference_t<R>>
+    && error_policy<Policy>
+    && std::default_initializable<T>
+    && std::assignable_from<T&, std::invoke_result_t<decltype(Func), std::ranges::range_reference_t<R>>>
+)
+std::expected<void, policy_error_t<Policy>> parallel_transform_noexcept(
+    R&& input,
+    columnar_result<T, policy_error_t<Policy>>& output,
+    thread_pool& pool,
+    failure_mode mode
+) noexcept
+{
+    using E = policy_error_t<Policy>;
+    using writer = internal::columnar_writer<T, E>;
+    const std::size_t start = output.size();
+    const std::size_t count = std::ranges::size(input);
+    const std::size_t chunks = (count + transform_chunk_size - 1) / transform_chunk_size;
+    // Failures stay per chunk so workers never share a container, they are
+    // merged in index order once every chunk finished. Only the elements are
+    // calls of Policy, the bookkeeping runs unobserved.
+    std::vector<internal::chunk_failures<E>> failures;
+    auto&& prepared = internal::guard<internal::unobserved<Policy>, void>([&]() {
+        failures.resize(chunks);
+        writer::grow(output, count);
+    });
+    if (!prepared.has_value()) [[unlikely]] {
+        writer::shrink(output, start);
+        return prepared;
+    }
+
+    std::atomic<bool> cancelled{false};
+    const auto first = std::ranges::begin(input);
+    pool.run(chunks, [&](std::size_t chunk) noexcept {
+        if (mode == failure_mode::cancel && cancelled.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const std::size_t chunk_start = chunk * transform_chunk_size;
+        const std::size_t chunk_size = std::min(transform_chunk_size, count - chunk_start);
+        auto it = first + chunk_start;
+        const auto last = it + chunk_size;
+        auto& chunk_failures = failures[chunk];
+        internal::transform_chunk<Func, Policy>(
+            it,
+            last,
+            &writer::value(output, start + chunk_start),
+            chunk_size,
+            [&](std::size_t offset, E&& error) noexcept {
+                if (mode == failure_mode::cancel) {
+                    cancelled.store(true, std::memory_order_relaxed);
+                }
+                if (chunk_failures.fatal.has_value()) {
+                    return;
+                }
+                auto&& pushed = internal::guard<internal::unobserved<Policy>, void>([&]() {
+                    chunk_failures.errors.push_back(
+                        indexed_error<E>{start + chunk_start + offset, std::move(error)}
+                    );
+                });
+                if (!pushed.has_value()) [[unlikely]] {
+                    chunk_failures.fatal.emplace(std::move(pushed).error());
+                }
+            }
+        );
+    });
+
+    for (auto& chunk_failures : failures) {
+        if (chunk_failures.fatal.has_value()) [[unlikely]] {
+            writer::shrink(output, start);
+            return std::unexpected(std::move(*chunk_failures.fatal));
+        }
+        if (mode == failure_mode::cancel && !chunk_failures.errors.empty()) {
+            writer::shrink(output, start);
+            return std::unexpected(std::move(chunk_failures.errors.front().error));
+        }
+    }
+    std::size_t failure_count = 0;
+    for (const auto& chunk_failures : failures) {
+        failure_count += chunk_failures.errors.size();
+    }
+    auto&& reserved = internal::guard<internal::unobserved<Policy>, void>([&]() {
+        writer::reserve_errors(output, failure_count);
+    });
+    if (!reserved.has_value()) [[unlikely]] {
+        writer::shrink(output, start);
+        return reserved;
+    }
+    // Cannot allocate anymore
+    for (auto& chunk_failures : failures) {
+        for (auto& failure : chunk_failures.errors) {
+            writer::fail(output, failure.index, std::move(failure.error));
+        }
+    }
+    return {};
+}
+
+} // namespace mica
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <concepts>
+#include <expected>
+#include <mica/errc.hpp>
+#include <mica/error_traits.hpp>
+#include <mica/try_vector.hpp>
+#include <mica/type_traits.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace mica {
+
+// Arithmetic types parse accepts. bool and character types are excluded,
+// signed char and unsigned char parse as numbers.
+template<typename T>
+concept parsable = (std::integral<T> && !std::same_as<T, bool> && !internal::character<T>)
+    || std::floating_point<T>;
+
+namespace internal {
+
+// Decimal integers of up to digits10 digits are validated and converted 8
+// digits at a time, everything else goes through std::from_chars
+template<parsable T>
+std::expected<T, errc> parse_field(const char* first, const char* last) noexcept;
+
+} // namespace mica::internal
+
+// Parses the whole text in the format of std::from_chars: decimal integers,
+// or floating point numbers in fixed or scientific notation. Leading '+' and
+// whitespace are rejected. Fails with errc::invalid_argument, or
+// errc::out_of_range when the value does not fit T. Malformed text costs
+// no more than well-formed text, nothing is thrown.
+template<parsable T, error_type E = std::string>
+std::expected<T, E> parse(std::string_view text) noexcept;
+
+// Appends one element per field of buffer to output, holding the value or
+// the error of the field. Fields are separated by delimiter; a delimiter
+// ending buffer does not start another field, so a column of lines may end
+// with a newline. Fails only when output cannot grow.
+template<parsable T, error_type E = std::string>
+std::expected<void, E> parse_column(
+    std::string_view buffer,
+    char delimiter,
+    try_vector<std::expected<T, errc>>& output
+) noexcept;
+
+} // namespace mica
+
+#include <mica/parse.inl>
@@ -0,0 +1,131 @@
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <utility>
+
+namespace mica {
+
+namespace internal {
+
+// Value of the 8 digits at text, false if any of them is not a digit.
+// Little endian only, the first digit is the lowest byte.
+inline bool parse_eight_digits(const char* text, std::uint64_t& value) noexcept
+{
+    std::uint64_t chunk;
+    std::memcpy(&chunk, text, sizeof(chunk));
+    // A byte is a digit when its high nibble is 3, and still is after adding 6
+    const std::uint64_t high = chunk & 0xf0f0f0f0f0f0f0f0;
+    const std::uint64_t carried = (chunk + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0;
+    if ((high | (carried >> 4)) != 0x3333333333333333) {
+        return false;
+    }
+    chunk -= 0x3030303030303030;
+    chunk = chunk * 10 + (chunk >> 8);
+    value = ((chunk & 0x000000ff000000ff) * (100 + (1000000ull << 32))
+        + ((chunk >> 16) & 0x000000ff000000ff) * (1 + (10000ull << 32))) >> 32;
+    return true;
+}
+
+template<parsable T>
+std::expected<T, errc> from_chars_field(const char* first, const char* last) noexcept
+{
+    T value;
+    const std::from_chars_result result = std::from_chars(first, last, value);
+    if (result.ec == std::errc::result_out_of_range) {
+        return std::unexpected(errc::out_of_range);
+    }
+    if (result.ec != std::errc() || result.ptr != last) {
+        return std::unexpected(errc::invalid_argument);
+    }
+    return value;
+}
+
+template<parsable T>
+std::expected<T, errc> parse_integer(const char* first, const char* last) noexcept
+{
+    const char* digits = first;
+    bool negative = false;
+    if constexpr (std::is_signed_v<T>) {
+        if (digits != last && *digits == '-') {
+            negative = true;
+            ++digits;
+        }
+    }
+    // Fewer than digits10 + 1 digits cannot overflow
+    const auto length = static_cast<std::size_t>(last - digits);
+    if (length == 0 || length > static_cast<std::size_t>(std::numeric_limits<T>::digits10)) {
+        return from_chars_field<T>(first, last);
+    }
+    std::uint64_t value = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        while (last - digits >= 8) {
+            std::uint64_t chunk;
+            if (!parse_eight_digits(digits, chunk)) {
+                return std::unexpected(errc::invalid_argument);
+            }
+            value = value * 100000000 + chunk;
+            digits += 8;
+        }
+    }
+    for (; digits != last; ++digits) {
+        const auto digit = static_cast<unsigned char>(*digits - '0');
+        if (digit > 9) {
+            return std::unexpected(errc::invalid_argument);
+        }
+        value = value * 10 + digit;
+    }
+    if (negative) {
+        return static_cast<T>(-static_cast<T>(value));
+    }
+    return static_cast<T>(value);
+}
+
+template<parsable T>
+std::expected<T, errc> parse_field(const char* first, const char* last) noexcept
+{
+    if constexpr (std::integral<T>) {
+        return parse_integer<T>(first, last);
+    } else {
+        return from_chars_field<T>(first, last);
+    }
+}
+
+} // namespace mica::internal
+
+template<parsable T, error_type E>
+std::expected<T, E> parse(std::string_view text) noexcept
+{
+    auto&& parsed = internal::parse_field<T>(text.data(), text.data() + text.size());
+    if (!parsed.has_value()) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(parsed.error()));
+    }
+    return *parsed;
+}
+
+// Delimiters are found with memchr, which the C library vectorizes
+template<parsable T, error_type E>
+std::expected<void, E> parse_column(
+    std::string_view buffer,
+    char delimiter,
+    try_vector<std::expected<T, errc>>& output
+) noexcept
+{
+    const char* first = buffer.data();
+    const char* const end = buffer.data() + buffer.size();
+    while (first != end) {
+        const void* found = std::memchr(first, delimiter, static_cast<std::size_t>(end - first));
+        const char* last = found != nullptr ? static_cast<const char*>(found) : end;
+        auto&& pushed = output.template try_push_back<E>(internal::parse_field<T>(first, last));
+        if (!pushed.has_value()) [[unlikely]] {
+            return std::unexpected(std::move(pushed).error());
+        }
+        first = last == end ? end : last + 1;
+    }
+    return {};
+}
+
+} // namespace mica
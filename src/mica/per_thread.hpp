@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+namespace mica {
+
+namespace internal {
+
+// Per-thread blocks of instrumentation data. Each thread writes only to its
+// own block, so recording takes no lock. The registry knows every live block
+// and folds the blocks of exited threads into a retired block, so readers
+// see the data of every thread. Block is default constructible, has
+// previous and next pointers, and a merge(const Block&) member.
+template<typename Block>
+class block_registry {
+public:
+    static block_registry& global() noexcept;
+
+    block_registry(const block_registry&) = delete;
+
+    block_registry& operator=(const block_registry&) = delete;
+
+    void attach(Block* block) noexcept;
+
+    // Merges block into the retired block, then forgets it
+    void detach(Block* block) noexcept;
+
+    // Calls visit with the retired block, then with every live block. Blocks
+    // may be written concurrently by their threads.
+    template<typename F>
+    void visit(F&& visit);
+
+private:
+    block_registry() = default;
+
+    std::mutex mutex_;
+    Block* live_ = nullptr;
+    std::unique_ptr<Block> retired_ = std::make_unique<Block>();
+};
+
+// Block of the calling thread, nullptr if it could not be allocated
+template<typename Block>
+Block* local_block() noexcept;
+
+} // namespace mica::internal
+
+} // namespace mica
+
+#include <mica/per_thread.inl>
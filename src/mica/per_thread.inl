@@ -0,0 +1,93 @@
+#include <new>
+#include <utility>
+
+namespace mica {
+
+namespace internal {
+
+template<typename Block>
+block_registry<Block>& block_registry<Block>::global() noexcept
+{
+    static block_registry registry;
+    return registry;
+}
+
+template<typename Block>
+void block_registry<Block>::attach(Block* block) noexcept
+{
+    std::lock_guard lock(mutex_);
+    block->next = live_;
+    if (live_ != nullptr) {
+        live_->previous = block;
+    }
+    live_ = block;
+}
+
+template<typename Block>
+void block_registry<Block>::detach(Block* block) noexcept
+{
+    std::lock_guard lock(mutex_);
+    retired_->merge(*block);
+    if (block->previous != nullptr) {
+        block->previous->next = block->next;
+    } else {
+        live_ = block->next;
+    }
+    if (block->next != nullptr) {
+        block->next->previous = block->previous;
+    }
+}
+
+template<typename Block>
+template<typename F>
+void block_registry<Block>::visit(F&& visit)
+{
+    std::lock_guard lock(mutex_);
+    visit(std::as_const(*retired_));
+    for (const Block* block = live_; block != nullptr; block = block->next) {
+        visit(*block);
+    }
+}
+
+template<typename Block>
+class block_owner {
+public:
+    block_owner() noexcept
+        : block_(new (std::nothrow) Block)
+    {
+        if (block_ != nullptr) {
+            block_registry<Block>::global().attach(block_);
+        }
+    }
+
+    block_owner(const block_owner&) = delete;
+
+    block_owner& operator=(const block_owner&) = delete;
+
+    ~block_owner()
+    {
+        if (block_ != nullptr) {
+            block_registry<Block>::global().detach(block_);
+            delete block_;
+        }
+    }
+
+    Block* block() const noexcept
+    {
+        return block_;
+    }
+
+private:
+    Block* block_;
+};
+
+template<typename Block>
+Block* local_block() noexcept
+{
+    thread_local block_owner<Block> owner;
+    return owner.block();
+}
+
+} // namespace mica::internal
+
+} // namespace mica
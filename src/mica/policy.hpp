@@ -0,0 +1,176 @@
+#pragma once
+
+#include <concepts>
+#include <expected>
+#include <mica/error_traits.hpp>
+#include <type_traits>
+
+namespace mica {
+
+// Translate exceptions of type Ex (and types derived from it) with Fn. Fn is a
+// default constructible function object invocable with const Ex& or with no
+// arguments.
+template<typename Ex, typename Fn>
+struct on
+{
+    using exception_type = Ex;
+
+    static constexpr auto translate(const Ex& e);
+};
+
+// Translate every exception not matched by a previous translator with Fn. Fn is
+// a default constructible function object invocable with no arguments. Must be
+// the last entry of a translators list.
+template<typename Fn>
+struct otherwise
+{
+    static constexpr auto translate();
+};
+
+// Ordered list of translators, tried first to last like a catch ladder. The
+// error type is the common type of all translator results. Exceptions not
+// matched by any translator fall back to error_traits, unless the list ends
+// with otherwise.
+template<typename... Translators>
+struct translators
+{};
+
+// Maps a make_noexcept policy to its error type and catch handlers. A policy is
+// either an error type with error_traits, or a translators list.
+template<typename Policy>
+struct policy_traits
+{};
+
+template<error_type E>
+struct policy_traits<E>
+{
+    using error_type = E;
+    using handlers = translators<>;
+};
+
+template<typename... Translators>
+struct policy_traits<translators<Translators...>>;
+
+template<typename Policy>
+concept error_policy = requires {
+    typename policy_traits<Policy>::error_type;
+    typename policy_traits<Policy>::handlers;
+};
+
+template<error_policy Policy>
+using policy_error_t = typename policy_traits<Policy>::error_type;
+
+namespace internal {
+
+// Watches the calls guarded for a policy. A new observer is constructed
+// before every call and told once how it ended, a failure from inside the
+// catch handler while the exception is still active. Policies opt in by
+// declaring an observer type in their policy_traits.
+struct no_observer
+{
+    constexpr void success() const noexcept;
+
+    constexpr void failure() const noexcept;
+};
+
+// Reports to Inner, then Outer. Chaining with no_observer yields the other.
+template<typename Inner, typename Outer>
+struct observer_chain
+{
+    void success() noexcept;
+
+    void failure() noexcept;
+
+    Inner inner;
+    Outer outer;
+};
+
+template<typename Inner, typename Outer>
+struct chain_observers
+{
+    using type = observer_chain<Inner, Outer>;
+};
+
+template<typename Outer>
+struct chain_observers<no_observer, Outer>
+{
+    using type = Outer;
+};
+
+template<typename Inner>
+struct chain_observers<Inner, no_observer>
+{
+    using type = Inner;
+};
+
+template<>
+struct chain_observers<no_observer, no_observer>
+{
+    using type = no_observer;
+};
+
+template<typename Inner, typename Outer>
+using chain_observers_t = typename chain_observers<Inner, Outer>::type;
+
+template<typename Policy>
+struct policy_observer
+{
+    using type = no_observer;
+};
+
+template<typename Policy>
+requires requires { typename policy_traits<Policy>::observer; }
+struct policy_observer<Policy>
+{
+    using type = typename policy_traits<Policy>::observer;
+};
+
+template<typename Policy>
+using policy_observer_t = typename policy_observer<Policy>::type;
+
+// Builds the errors of exceptions no translator matched, with the
+// from_exception and from_unknown members of error_traits. Policies replace
+// it by declaring a fallback type in their policy_traits.
+template<typename Policy>
+struct policy_fallback
+{
+    using type = error_traits<policy_error_t<Policy>>;
+};
+
+template<typename Policy>
+requires requires { typename policy_traits<Policy>::fallback; }
+struct policy_fallback<Policy>
+{
+    using type = typename policy_traits<Policy>::fallback;
+};
+
+template<typename Policy>
+using policy_fallback_t = typename policy_fallback<Policy>::type;
+
+// Policy without its observer, for the bookkeeping of a function that is not
+// a call the policy should count or time
+template<typename Policy>
+struct unobserved
+{};
+
+} // namespace mica::internal
+
+template<error_policy Policy>
+struct policy_traits<internal::unobserved<Policy>>
+{
+    using error_type = policy_error_t<Policy>;
+    using handlers = typename policy_traits<Policy>::handlers;
+    using fallback = internal::policy_fallback_t<Policy>;
+};
+
+namespace internal {
+
+// Invoke func inside the catch handlers of Policy
+template<error_policy Policy, typename R, typename F>
+constexpr std::expected<R, policy_error_t<Policy>> guard(F&& func) noexcept;
+
+} // namespace mica::internal
+
+} // namespace mica
+
+#include <mica/policy.inl>
@@ -0,0 +1,236 @@
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <tuple>
+#include <utility>
+
+namespace mica {
+
+template<typename Ex, typename Fn>
+constexpr auto on<Ex, Fn>::translate(const Ex& e)
+{
+    if constexpr (std::invocable<Fn, const Ex&>) {
+        return std::invoke(Fn(), e);
+    } else {
+        return std::invoke(Fn());
+    }
+}
+
+template<typename Fn>
+constexpr auto otherwise<Fn>::translate()
+{
+    return std::invoke(Fn());
+}
+
+namespace internal {
+
+constexpr void no_observer::success() const noexcept
+{}
+
+constexpr void no_observer::failure() const noexcept
+{}
+
+template<typename Inner, typename Outer>
+void observer_chain<Inner, Outer>::success() noexcept
+{
+    inner.success();
+    outer.success();
+}
+
+template<typename Inner, typename Outer>
+void observer_chain<Inner, Outer>::failure() noexcept
+{
+    inner.failure();
+    outer.failure();
+}
+
+template<typename T>
+struct is_otherwise : std::false_type
+{};
+
+template<typename Fn>
+struct is_otherwise<otherwise<Fn>> : std::true_type
+{};
+
+template<typename T>
+constexpr bool is_otherwise_v = is_otherwise<T>::value;
+
+template<typename Translator>
+struct translator_result;
+
+template<typename Ex, typename Fn>
+struct translator_result<on<Ex, Fn>>
+{
+    using type = decltype(on<Ex, Fn>::translate(std::declval<const Ex&>()));
+};
+
+template<typename Fn>
+struct translator_result<otherwise<Fn>>
+{
+    using type = decltype(otherwise<Fn>::translate());
+};
+
+template<typename Translator>
+using translator_result_t = typename translator_result<Translator>::type;
+
+template<typename Handlers>
+struct handler_count;
+
+template<typename... Translators>
+struct handler_count<translators<Translators...>>
+    : std::integral_constant<std::size_t, sizeof...(Translators)>
+{};
+
+template<typename Handlers>
+constexpr std::size_t handler_count_v = handler_count<Handlers>::value;
+
+template<std::size_t I, typename Handlers>
+struct handler_at;
+
+template<std::size_t I, typename... Translators>
+struct handler_at<I, translators<Translators...>>
+{
+    using type = std::tuple_element_t<I, std::tuple<Translators...>>;
+};
+
+template<std::size_t I, typename Handlers>
+using handler_at_t = typename handler_at<I, Handlers>::type;
+
+template<typename Handlers>
+struct ends_with_otherwise : std::false_type
+{};
+
+template<typename... Translators>
+requires (sizeof...(Translators) > 0)
+struct ends_with_otherwise<translators<Translators...>>
+    : is_otherwise<handler_at_t<sizeof...(Translators) - 1, translators<Translators...>>>
+{};
+
+template<typename Handlers>
+constexpr bool ends_with_otherwise_v = ends_with_otherwise<Handlers>::value;
+
+template<typename R, typename E, typename F, typename Observer>
+constexpr std::expected<R, E> invoke_expected(F& func, Observer& observer)
+{
+    if constexpr (std::is_void_v<R>) {
+        std::invoke(func);
+        observer.success();
+        return std::expected<R, E>();
+    } else if constexpr (std::is_same_v<Observer, no_observer>) {
+        return std::invoke(func);
+    } else {
+        std::expected<R, E> output(std::invoke(func));
+        observer.success();
+        return output;
+    }
+}
+
+// Error construction is outlined into cold, non-inlined helpers templated
+// only on the error type and the translator or fallback building it. Wrapped
+// functions of every return type share them, and each contributes just a
+// landing pad wrapping the error into its expected.
+template<typename E, typename H, typename Ex>
+[[gnu::cold, gnu::noinline]] E error_from_translator(const Ex& e)
+{
+    return E(H::translate(e));
+}
+
+template<typename E, typename H>
+[[gnu::cold, gnu::noinline]] E error_from_translator()
+{
+    return E(H::translate());
+}
+
+template<typename E, typename Fallback = error_traits<E>>
+[[gnu::cold, gnu::noinline]] E error_from_exception(const std::exception& e)
+{
+    return Fallback::from_exception(e);
+}
+
+template<typename E, typename Fallback = error_traits<E>>
+[[gnu::cold, gnu::noinline]] E error_from_unknown()
+{
+    return Fallback::from_unknown();
+}
+
+// Wraps the call in handlers [0, I). The first handler is the innermost try
+// block so it is matched first, exactly like a hand-written catch ladder.
+template<typename Handlers, std::size_t I, typename R, typename E, typename F, typename Observer>
+constexpr std::expected<R, E> invoke_handled(F& func, Observer& observer)
+{
+    if constexpr (I == 0) {
+        return invoke_expected<R, E>(func, observer);
+    } else {
+        using H = handler_at_t<I - 1, Handlers>;
+        if constexpr (is_otherwise_v<H>) {
+            try {
+                return invoke_handled<Handlers, I - 1, R, E>(func, observer);
+            } catch (...) {
+                observer.failure();
+                return std::unexpected(error_from_translator<E, H>());
+            }
+        } else {
+            try {
+                return invoke_handled<Handlers, I - 1, R, E>(func, observer);
+            } catch (const typename H::exception_type& e) {
+                observer.failure();
+                return std::unexpected(error_from_translator<E, H>(e));
+            }
+        }
+    }
+}
+
+template<error_policy Policy, typename R, typename F>
+constexpr std::expected<R, policy_error_t<Policy>> guard(F&& func) noexcept
+{
+    using E = policy_error_t<Policy>;
+    using Handlers = typename policy_traits<Policy>::handlers;
+    constexpr std::size_t count = handler_count_v<Handlers>;
+    policy_observer_t<Policy> observer;
+    if constexpr (ends_with_otherwise_v<Handlers>) {
+        return invoke_handled<Handlers, count, R, E>(func, observer);
+    } else {
+        static_assert(
+            error_type<E>,
+            "A translators list without otherwise requires error_traits for its error type"
+        );
+        using Fallback = policy_fallback_t<Policy>;
+        try {
+            return invoke_handled<Handlers, count, R, E>(func, observer);
+        } catch (const std::exception& e) {
+            observer.failure();
+            return std::unexpected(error_from_exception<E, Fallback>(e));
+        } catch (...) {
+            observer.failure();
+            return std::unexpected(error_from_unknown<E, Fallback>());
+        }
+    }
+}
+
+template<std::size_t I, typename... Translators>
+constexpr bool otherwise_is_last()
+{
+    if constexpr (I + 1 >= sizeof...(Translators)) {
+        return true;
+    } else {
+        return !is_otherwise_v<handler_at_t<I, translators<Translators...>>>
+            && otherwise_is_last<I + 1, Translators...>();
+    }
+}
+
+} // namespace mica::internal
+
+template<typename... Translators>
+struct policy_traits<translators<Translators...>>
+{
+    static_assert(sizeof...(Translators) > 0, "translators list must not be empty");
+    static_assert(
+        internal::otherwise_is_last<0, Translators...>(),
+        "otherwise must be the last entry of a translators list"
+    );
+
+    using error_type = std::common_type_t<internal::translator_result_t<Translators>...>;
+    using handlers = translators<Translators...>;
+};
+
+} // namespace mica
@@ -6,6 +6,11 @@ namespace mica {
 template<typename Sig, Sig* Func>
 constexpr auto resolve() -> Sig*;
 
+// Resolve member function of C, Sig includes its qualifiers:
+//     resolve<std::string(std::size_t, std::size_t) const, std::string, &std::string::substr>()
+template<typename Sig, typename C, Sig C::* Func>
+constexpr auto resolve() -> Sig C::*;
+
 } // namespace mica
 
 #include <mica/resolve.inl>
@@ -6,4 +6,10 @@ constexpr auto resolve() -> Sig*
     return Func;
 }
 
+template<typename Sig, typename C, Sig C::* Func>
+constexpr auto resolve() -> Sig C::*
+{
+    return Func;
+}
+
 } // namespace mica
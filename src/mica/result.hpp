@@ -0,0 +1,116 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <expected>
+#include <mica/frame_pool.hpp>
+#include <mica/task.hpp>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace mica {
+
+template<typename T, typename E>
+class result;
+
+namespace internal {
+
+template<typename T, typename E>
+class result_promise;
+
+template<typename Exp, typename T, typename E>
+class result_awaiter;
+
+template<typename T, typename E>
+class result_promise_base {
+public:
+    // Frames come from the frame pool of the calling thread
+    static void* operator new(std::size_t size);
+
+    static void operator delete(void* frame, std::size_t size) noexcept;
+
+    result<T, E> get_return_object() noexcept;
+
+    std::suspend_never initial_suspend() const noexcept;
+
+    std::suspend_always final_suspend() const noexcept;
+
+    // Exceptions become the error when E has error_traits, they terminate
+    // otherwise
+    void unhandled_exception() noexcept;
+
+    template<typename Exp>
+    requires propagates_to<std::remove_cvref_t<Exp>, std::expected<T, E>>
+    result_awaiter<Exp&&, T, E> await_transform(Exp&& exp) noexcept;
+
+    template<typename U, typename F>
+    requires propagates_to<std::expected<U, F>, std::expected<T, E>>
+    result_awaiter<std::expected<U, F>, T, E> await_transform(result<U, F>&& child) noexcept;
+
+    template<typename F>
+    void fail(F&& error) noexcept;
+
+    std::expected<T, E> take() noexcept;
+
+protected:
+    std::optional<std::expected<T, E>> result_;
+};
+
+template<typename T, typename E>
+class result_promise : public result_promise_base<T, E> {
+public:
+    template<typename U = T>
+    requires std::constructible_from<std::expected<T, E>, U&&>
+    void return_value(U&& value) noexcept(std::is_nothrow_constructible_v<std::expected<T, E>, U&&>);
+};
+
+template<typename E>
+class result_promise<void, E> : public result_promise_base<void, E> {
+public:
+    void return_void() noexcept;
+};
+
+} // namespace mica::internal
+
+// Return type of a synchronous coroutine computing a std::expected<T, E>.
+// The coroutine runs to completion when called. co_await on a std::expected
+// or a result yields the value, or returns its error early, like MICA_TRY:
+//
+//     mica::result<int> sum(std::string_view a, std::string_view b)
+//     {
+//         co_return co_await parse(a) + co_await parse(b);
+//     }
+//
+// The frame is destroyed by the result and allocated from the frame pool of
+// the calling thread.
+template<typename T, typename E = std::string>
+class [[nodiscard]] result {
+public:
+    using promise_type = internal::result_promise<T, E>;
+
+    using value_type = T;
+
+    using error_type = E;
+
+    result(result&& other) noexcept;
+
+    result& operator=(result&& other) noexcept;
+
+    ~result();
+
+    std::expected<T, E> get() && noexcept;
+
+    operator std::expected<T, E>() && noexcept;
+
+private:
+    friend class internal::result_promise_base<T, E>;
+
+    explicit result(std::coroutine_handle<promise_type> handle) noexcept;
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+} // namespace mica
+
+#include <mica/result.inl>
@@ -0,0 +1,173 @@
+#include <exception>
+#include <mica/policy.hpp>
+#include <utility>
+
+namespace mica {
+
+namespace internal {
+
+template<typename Exp, typename T, typename E>
+class result_awaiter {
+public:
+    explicit result_awaiter(Exp exp) noexcept
+        : exp_(std::forward<Exp>(exp))
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return exp_.has_value();
+    }
+
+    // The coroutine stays suspended, control returns to its caller
+    void await_suspend(std::coroutine_handle<result_promise<T, E>> handle) noexcept
+    {
+        handle.promise().fail(std::forward<Exp>(exp_).error());
+    }
+
+    awaited_value_t<Exp> await_resume() noexcept(nothrow_awaited_value<Exp>)
+    {
+        if constexpr (!std::is_void_v<awaited_value_t<Exp>>) {
+            return *std::forward<Exp>(exp_);
+        }
+    }
+
+private:
+    Exp exp_;
+};
+
+template<typename T, typename E>
+void* result_promise_base<T, E>::operator new(std::size_t size)
+{
+    return allocate_frame(size);
+}
+
+template<typename T, typename E>
+void result_promise_base<T, E>::operator delete(void* frame, std::size_t size) noexcept
+{
+    deallocate_frame(frame, size);
+}
+
+template<typename T, typename E>
+result<T, E> result_promise_base<T, E>::get_return_object() noexcept
+{
+    return result<T, E>(std::coroutine_handle<result_promise<T, E>>::from_promise(
+        static_cast<result_promise<T, E>&>(*this)
+    ));
+}
+
+template<typename T, typename E>
+std::suspend_never result_promise_base<T, E>::initial_suspend() const noexcept
+{
+    return {};
+}
+
+template<typename T, typename E>
+std::suspend_always result_promise_base<T, E>::final_suspend() const noexcept
+{
+    return {};
+}
+
+template<typename T, typename E>
+void result_promise_base<T, E>::unhandled_exception() noexcept
+{
+    if constexpr (error_type<E>) {
+        try {
+            throw;
+        } catch (const std::exception& e) {
+            result_.emplace(std::unexpected(error_from_exception<E>(e)));
+        } catch (...) {
+            result_.emplace(std::unexpected(error_from_unknown<E>()));
+        }
+    } else {
+        std::terminate();
+    }
+}
+
+template<typename T, typename E>
+template<typename Exp>
+requires propagates_to<std::remove_cvref_t<Exp>, std::expected<T, E>>
+result_awaiter<Exp&&, T, E> result_promise_base<T, E>::await_transform(Exp&& exp) noexcept
+{
+    return result_awaiter<Exp&&, T, E>(std::forward<Exp>(exp));
+}
+
+template<typename T, typename E>
+template<typename U, typename F>
+requires propagates_to<std::expected<U, F>, std::expected<T, E>>
+result_awaiter<std::expected<U, F>, T, E> result_promise_base<T, E>::await_transform(result<U, F>&& child) noexcept
+{
+    return result_awaiter<std::expected<U, F>, T, E>(std::move(child).get());
+}
+
+template<typename T, typename E>
+template<typename F>
+void result_promise_base<T, E>::fail(F&& error) noexcept
+{
+    result_.emplace(std::unexpect, std::forward<F>(error));
+}
+
+template<typename T, typename E>
+std::expected<T, E> result_promise_base<T, E>::take() noexcept
+{
+    return std::move(*result_);
+}
+
+template<typename T, typename E>
+template<typename U>
+requires std::constructible_from<std::expected<T, E>, U&&>
+void result_promise<T, E>::return_value(U&& value) noexcept(std::is_nothrow_constructible_v<std::expected<T, E>, U&&>)
+{
+    this->result_.emplace(std::forward<U>(value));
+}
+
+template<typename E>
+void result_promise<void, E>::return_void() noexcept
+{
+    this->result_.emplace();
+}
+
+} // namespace mica::internal
+
+template<typename T, typename E>
+result<T, E>::result(std::coroutine_handle<promise_type> handle) noexcept
+    : handle_(handle)
+{}
+
+template<typename T, typename E>
+result<T, E>::result(result&& other) noexcept
+    : handle_(std::exchange(other.handle_, nullptr))
+{}
+
+template<typename T, typename E>
+result<T, E>& result<T, E>::operator=(result&& other) noexcept
+{
+    if (this != &other) {
+        if (handle_) {
+            handle_.destroy();
+        }
+        handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+}
+
+template<typename T, typename E>
+result<T, E>::~result()
+{
+    if (handle_) {
+        handle_.destroy();
+    }
+}
+
+template<typename T, typename E>
+std::expected<T, E> result<T, E>::get() && noexcept
+{
+    return handle_.promise().take();
+}
+
+template<typename T, typename E>
+result<T, E>::operator std::expected<T, E>() && noexcept
+{
+    return handle_.promise().take();
+}
+
+} // namespace mica
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mica/error.hpp>
+#include <mica/error_traits.hpp>
+#include <mica/policy.hpp>
+
+namespace mica {
+
+// Captures the first failure and then one failure in N, per call site and
+// thread. Deciding decrements a thread-local counter.
+template<std::size_t N>
+struct one_in
+{
+    static_assert(N > 0, "one_in requires N > 0");
+
+    template<typename Site>
+    static bool sample() noexcept;
+};
+
+namespace internal {
+
+// Trivially constructible, so a thread_local bucket needs no initialization
+// guard. The clock is read only once the tokens are spent.
+struct token_bucket
+{
+    bool take(std::uint64_t per_second, std::uint64_t burst) noexcept;
+
+    std::uint64_t tokens = 0;
+    std::int64_t refilled = 0;
+};
+
+} // namespace mica::internal
+
+// Captures up to PerSecond failures per second, and bursts of up to Burst
+// failures, per call site and thread
+template<std::uint64_t PerSecond, std::uint64_t Burst = PerSecond>
+struct rate_limited
+{
+    static_assert(PerSecond > 0 && Burst > 0, "rate_limited requires a positive rate and burst");
+    static_assert(PerSecond <= 1000000000, "rate_limited supports at most one failure per nanosecond");
+
+    template<typename Site>
+    static bool sample() noexcept;
+};
+
+namespace internal {
+
+// Builds the error of a sampled failure with Inner, others with
+// error_traits<E>::from_suppressed, given the code of the exception when it
+// takes one
+template<typename Inner, typename E, typename Site, typename Sampler>
+struct sampled_fallback
+{
+    static E from_exception(const std::exception& e);
+
+    static E from_unknown();
+};
+
+} // namespace mica::internal
+
+// Wraps an error policy and captures the message of exceptions only for the
+// failures Sampler picks. The other failures carry a "suppressed" marker
+// instead of a copy of what(). mica::error and interned keep the code of the
+// exception as well; std::string errors are the marker alone, which fits the
+// small string buffer, so a suppressed failure allocates nothing. Translators
+// of the wrapped policy still translate every exception they match.
+//     make_noexcept<parse, mica::sampled<std::string, MICA_CALL_SITE, mica::one_in<100>>>(text);
+template<error_policy Policy, typename Site, typename Sampler = one_in<100>>
+struct sampled
+{};
+
+template<error_policy Policy, typename Site, typename Sampler>
+struct policy_traits<sampled<Policy, Site, Sampler>>
+{
+    using error_type = policy_error_t<Policy>;
+    using handlers = typename policy_traits<Policy>::handlers;
+    using observer = internal::policy_observer_t<Policy>;
+    using fallback = internal::sampled_fallback<internal::policy_fallback_t<Policy>, error_type, Site, Sampler>;
+};
+
+} // namespace mica
+
+#include <mica/sampling.inl>
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <chrono>
+
+namespace mica {
+
+template<std::size_t N>
+template<typename Site>
+bool one_in<N>::sample() noexcept
+{
+    thread_local std::size_t countdown = 0;
+    if (countdown == 0) [[unlikely]] {
+        countdown = N - 1;
+        return true;
+    }
+    --countdown;
+    return false;
+}
+
+namespace internal {
+
+inline bool token_bucket::take(std::uint64_t per_second, std::uint64_t burst) noexcept
+{
+    if (tokens == 0) {
+        constexpr std::int64_t second = std::chrono::nanoseconds(std::chrono::seconds(1)).count();
+        const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+        const auto elapsed = static_cast<std::uint64_t>(now - refilled);
+        // Refills in whole tokens and keeps the remainder, a fresh bucket
+        // starts full
+        const std::uint64_t earned = refilled == 0 ? burst : elapsed / (second / per_second);
+        if (earned == 0) {
+            return false;
+        }
+        tokens = std::min(earned, burst);
+        refilled = refilled == 0 || earned > burst
+            ? now
+            : refilled + static_cast<std::int64_t>(earned * (second / per_second));
+    }
+    --tokens;
+    return true;
+}
+
+} // namespace mica::internal
+
+template<std::uint64_t PerSecond, std::uint64_t Burst>
+template<typename Site>
+bool rate_limited<PerSecond, Burst>::sample() noexcept
+{
+    thread_local internal::token_bucket bucket;
+    return bucket.take(PerSecond, Burst);
+}
+
+namespace internal {
+
+template<typename Inner, typename E, typename Site, typename Sampler>
+E sampled_fallback<Inner, E, Site, Sampler>::from_exception(const std::exception& e)
+{
+    if (Sampler::template sample<Site>()) {
+        return Inner::from_exception(e);
+    }
+    // Skips the catch ladder of exception_code when the code is dropped
+    if constexpr (suppressed_without_code<E>) {
+        return error_traits<E>::from_suppressed();
+    } else {
+        return suppressed_error<E>(exception_code(e));
+    }
+}
+
+template<typename Inner, typename E, typename Site, typename Sampler>
+E sampled_fallback<Inner, E, Site, Sampler>::from_unknown()
+{
+    return Inner::from_unknown();
+}
+
+} // namespace mica::internal
+
+} // namespace mica
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <expected>
+#include <mica/frame_pool.hpp>
+#include <mica/type_traits.hpp>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace mica {
+
+template<typename T>
+class task;
+
+namespace internal {
+
+// Whoever is notified when a task completes. Returns the coroutine to resume
+// next, the awaiting coroutine for a parent task.
+struct task_waiter
+{
+    std::coroutine_handle<> (*on_complete)(task_waiter& waiter) noexcept;
+};
+
+class task_promise_base {
+public:
+    struct final_awaiter
+    {
+        bool await_ready() const noexcept;
+
+        template<typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept;
+
+        void await_resume() const noexcept;
+    };
+
+    // Frames come from the frame pool of the allocating thread
+    static void* operator new(std::size_t size);
+
+    static void operator delete(void* frame, std::size_t size) noexcept;
+
+    std::suspend_always initial_suspend() const noexcept;
+
+    final_awaiter final_suspend() const noexcept;
+
+    void set_waiter(task_waiter* waiter) noexcept;
+
+    // The coroutine to resume once this task is done
+    std::coroutine_handle<> complete() noexcept;
+
+private:
+    task_waiter* waiter_ = nullptr;
+};
+
+template<typename T, typename Parent>
+concept propagates_to = is_expected_v<T>
+    && is_expected_v<Parent>
+    && std::constructible_from<typename Parent::error_type, typename T::error_type&&>;
+
+// co_await on an expected yields its value by value, the expected may be a
+// temporary destroyed at the end of the co_await expression
+template<typename Exp>
+using awaited_value_t = typename std::remove_cvref_t<Exp>::value_type;
+
+template<typename Exp>
+inline constexpr bool nothrow_awaited_value = std::is_void_v<awaited_value_t<Exp>>
+    || std::is_nothrow_constructible_v<awaited_value_t<Exp>, decltype(*std::declval<Exp>())>;
+
+template<typename T>
+class task_promise;
+
+template<typename T>
+class task_awaiter;
+
+template<typename T, typename Parent>
+class propagating_task_awaiter;
+
+template<typename Exp, typename Parent>
+class expected_awaiter;
+
+template<typename T>
+class task_promise_common : public task_promise_base {
+public:
+    task<T> get_return_object() noexcept;
+
+    // A failed expected or task<expected> completes this task with its error
+    // instead of resuming it
+    template<typename C>
+    requires propagates_to<C, T>
+    propagating_task_awaiter<C, T> await_transform(task<C>&& child) noexcept;
+
+    template<typename Exp>
+    requires propagates_to<std::remove_cvref_t<Exp>, T>
+    expected_awaiter<Exp&&, T> await_transform(Exp&& exp) noexcept;
+
+    template<typename A>
+    A&& await_transform(A&& awaitable) noexcept;
+};
+
+template<typename T>
+class task_promise : public task_promise_common<T> {
+public:
+    template<typename U = T>
+    requires std::constructible_from<T, U&&>
+    void return_value(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>);
+
+    // Exceptions become the error of an expected T, they terminate otherwise
+    void unhandled_exception() noexcept;
+
+    // Completes the task with error without resuming it
+    template<typename E>
+    std::coroutine_handle<> fail(E&& error) noexcept;
+
+    bool has_value() const noexcept;
+
+    T take() noexcept;
+
+private:
+    std::optional<T> result_;
+};
+
+template<>
+class task_promise<void> : public task_promise_common<void> {
+public:
+    void return_void() const noexcept;
+
+    void unhandled_exception() const noexcept;
+
+    void take() const noexcept;
+};
+
+} // namespace mica::internal
+
+// Lazily started coroutine. Awaiting a task starts it and resumes the
+// awaiting coroutine, by symmetric transfer, once it completes. Inside a task
+// returning std::expected, co_await on a task<std::expected> or a
+// std::expected yields the value, or completes the awaiting task with the
+// error without resuming it, like MICA_TRY. Use as_expected() to get the
+// expected itself.
+template<typename T>
+class [[nodiscard]] task {
+public:
+    using promise_type = internal::task_promise<T>;
+
+    using value_type = T;
+
+    task(task&& other) noexcept;
+
+    task& operator=(task&& other) noexcept;
+
+    ~task();
+
+    internal::task_awaiter<T> operator co_await() && noexcept;
+
+    internal::task_awaiter<T> as_expected() && noexcept;
+
+private:
+    template<typename U>
+    friend class internal::task_promise_common;
+
+    template<typename U>
+    friend U sync_wait(task<U> t);
+
+    template<typename U, typename Parent>
+    friend class internal::propagating_task_awaiter;
+
+    friend class run_loop;
+
+    explicit task(std::coroutine_handle<promise_type> handle) noexcept;
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+// Runs t on the calling thread until it suspends, then blocks until it
+// completes, possibly on another thread.
+template<typename T>
+T sync_wait(task<T> t);
+
+} // namespace mica
+
+#include <mica/task.inl>
@@ -0,0 +1,321 @@
+#include <exception>
+#include <mica/policy.hpp>
+#include <semaphore>
+#include <utility>
+
+namespace mica {
+
+namespace internal {
+
+inline bool task_promise_base::final_awaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+template<typename P>
+std::coroutine_handle<> task_promise_base::final_awaiter::await_suspend(std::coroutine_handle<P> handle) noexcept
+{
+    return handle.promise().complete();
+}
+
+inline void task_promise_base::final_awaiter::await_resume() const noexcept
+{}
+
+inline void* task_promise_base::operator new(std::size_t size)
+{
+    return allocate_frame(size);
+}
+
+inline void task_promise_base::operator delete(void* frame, std::size_t size) noexcept
+{
+    deallocate_frame(frame, size);
+}
+
+inline std::suspend_always task_promise_base::initial_suspend() const noexcept
+{
+    return {};
+}
+
+inline task_promise_base::final_awaiter task_promise_base::final_suspend() const noexcept
+{
+    return {};
+}
+
+inline void task_promise_base::set_waiter(task_waiter* waiter) noexcept
+{
+    waiter_ = waiter;
+}
+
+// Nothing may touch the frame after the waiter was notified, the waiter is
+// free to destroy it
+inline std::coroutine_handle<> task_promise_base::complete() noexcept
+{
+    if (waiter_ == nullptr) {
+        return std::noop_coroutine();
+    }
+    return waiter_->on_complete(*waiter_);
+}
+
+// Resumes the awaiting coroutine with the result of the child as is
+template<typename T>
+class task_awaiter : public task_waiter {
+public:
+    explicit task_awaiter(std::coroutine_handle<task_promise<T>> child) noexcept
+        : task_waiter{&resume_parent},
+          child_(child)
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> parent) noexcept
+    {
+        parent_ = parent;
+        child_.promise().set_waiter(this);
+        return child_;
+    }
+
+    T await_resume() noexcept
+    {
+        return child_.promise().take();
+    }
+
+private:
+    static std::coroutine_handle<> resume_parent(task_waiter& waiter) noexcept
+    {
+        return static_cast<task_awaiter&>(waiter).parent_;
+    }
+
+    std::coroutine_handle<task_promise<T>> child_;
+    std::coroutine_handle<> parent_;
+};
+
+// Resumes the awaiting task with the value of the child, or completes it
+// with the error of the child
+template<typename T, typename Parent>
+class propagating_task_awaiter : public task_waiter {
+public:
+    explicit propagating_task_awaiter(std::coroutine_handle<task_promise<T>> child) noexcept
+        : task_waiter{&resume_parent},
+          child_(child)
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<task_promise<Parent>> parent) noexcept
+    {
+        parent_ = parent;
+        child_.promise().set_waiter(this);
+        return child_;
+    }
+
+    typename T::value_type await_resume() noexcept
+    {
+        return *child_.promise().take();
+    }
+
+private:
+    static std::coroutine_handle<> resume_parent(task_waiter& waiter) noexcept
+    {
+        auto& self = static_cast<propagating_task_awaiter&>(waiter);
+        auto& child = self.child_.promise();
+        if (child.has_value()) [[likely]] {
+            return self.parent_;
+        }
+        return self.parent_.promise().fail(child.take().error());
+    }
+
+    std::coroutine_handle<task_promise<T>> child_;
+    std::coroutine_handle<task_promise<Parent>> parent_;
+};
+
+template<typename Exp, typename Parent>
+class expected_awaiter {
+public:
+    explicit expected_awaiter(Exp exp) noexcept
+        : exp_(std::forward<Exp>(exp))
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return exp_.has_value();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<task_promise<Parent>> parent) noexcept
+    {
+        return parent.promise().fail(std::forward<Exp>(exp_).error());
+    }
+
+    awaited_value_t<Exp> await_resume() noexcept(nothrow_awaited_value<Exp>)
+    {
+        if constexpr (!std::is_void_v<awaited_value_t<Exp>>) {
+            return *std::forward<Exp>(exp_);
+        }
+    }
+
+private:
+    Exp exp_;
+};
+
+template<typename T>
+task<T> task_promise_common<T>::get_return_object() noexcept
+{
+    return task<T>(std::coroutine_handle<task_promise<T>>::from_promise(static_cast<task_promise<T>&>(*this)));
+}
+
+template<typename T>
+template<typename C>
+requires propagates_to<C, T>
+propagating_task_awaiter<C, T> task_promise_common<T>::await_transform(task<C>&& child) noexcept
+{
+    return propagating_task_awaiter<C, T>(child.handle_);
+}
+
+template<typename T>
+template<typename Exp>
+requires propagates_to<std::remove_cvref_t<Exp>, T>
+expected_awaiter<Exp&&, T> task_promise_common<T>::await_transform(Exp&& exp) noexcept
+{
+    return expected_awaiter<Exp&&, T>(std::forward<Exp>(exp));
+}
+
+template<typename T>
+template<typename A>
+A&& task_promise_common<T>::await_transform(A&& awaitable) noexcept
+{
+    return std::forward<A>(awaitable);
+}
+
+template<typename T>
+template<typename U>
+requires std::constructible_from<T, U&&>
+void task_promise<T>::return_value(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+{
+    result_.emplace(std::forward<U>(value));
+}
+
+template<typename T>
+void task_promise<T>::unhandled_exception() noexcept
+{
+    if constexpr (is_expected_v<T>) {
+        using E = typename T::error_type;
+        if constexpr (error_type<E>) {
+            try {
+                throw;
+            } catch (const std::exception& e) {
+                result_.emplace(std::unexpected(error_from_exception<E>(e)));
+            } catch (...) {
+                result_.emplace(std::unexpected(error_from_unknown<E>()));
+            }
+            return;
+        }
+    }
+    std::terminate();
+}
+
+template<typename T>
+template<typename E>
+std::coroutine_handle<> task_promise<T>::fail(E&& error) noexcept
+{
+    result_.emplace(std::unexpect, std::forward<E>(error));
+    return this->complete();
+}
+
+template<typename T>
+bool task_promise<T>::has_value() const noexcept
+{
+    return result_->has_value();
+}
+
+template<typename T>
+T task_promise<T>::take() noexcept
+{
+    return std::move(*result_);
+}
+
+inline void task_promise<void>::return_void() const noexcept
+{}
+
+inline void task_promise<void>::unhandled_exception() const noexcept
+{
+    std::terminate();
+}
+
+inline void task_promise<void>::take() const noexcept
+{}
+
+struct sync_waiter : task_waiter
+{
+    sync_waiter() noexcept
+        : task_waiter{&notify}
+    {}
+
+    static std::coroutine_handle<> notify(task_waiter& waiter) noexcept
+    {
+        static_cast<sync_waiter&>(waiter).done.release();
+        return std::noop_coroutine();
+    }
+
+    std::binary_semaphore done{0};
+};
+
+} // namespace mica::internal
+
+template<typename T>
+task<T>::task(std::coroutine_handle<promise_type> handle) noexcept
+    : handle_(handle)
+{}
+
+template<typename T>
+task<T>::task(task&& other) noexcept
+    : handle_(std::exchange(other.handle_, nullptr))
+{}
+
+template<typename T>
+task<T>& task<T>::operator=(task&& other) noexcept
+{
+    if (this != &other) {
+        if (handle_) {
+            handle_.destroy();
+        }
+        handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+}
+
+template<typename T>
+task<T>::~task()
+{
+    if (handle_) {
+        handle_.destroy();
+    }
+}
+
+template<typename T>
+internal::task_awaiter<T> task<T>::operator co_await() && noexcept
+{
+    return internal::task_awaiter<T>(handle_);
+}
+
+template<typename T>
+internal::task_awaiter<T> task<T>::as_expected() && noexcept
+{
+    return internal::task_awaiter<T>(handle_);
+}
+
+template<typename T>
+T sync_wait(task<T> t)
+{
+    internal::sync_waiter waiter;
+    t.handle_.promise().set_waiter(&waiter);
+    t.handle_.resume();
+    waiter.done.acquire();
+    return t.handle_.promise().take();
+}
+
+} // namespace mica
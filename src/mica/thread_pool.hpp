@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace mica {
+
+class thread_pool;
+
+namespace internal {
+
+// Indices [begin, end) still owned by a worker, packed into one atomic so
+// the owner and thieves agree through compare-exchange alone
+struct alignas(64) pool_worker
+{
+    std::atomic<std::uint64_t> range{0};
+};
+
+// Pools whose job the current thread is running, innermost first
+struct pool_scope
+{
+    explicit pool_scope(const thread_pool* pool) noexcept;
+
+    pool_scope(const pool_scope&) = delete;
+
+    pool_scope& operator=(const pool_scope&) = delete;
+
+    ~pool_scope();
+
+    static bool inside(const thread_pool* pool) noexcept;
+
+    inline static thread_local pool_scope* current = nullptr;
+
+    const thread_pool* pool;
+    pool_scope* previous;
+};
+
+// Jobs larger than this run in several rounds, ranges pack 32-bit indices
+inline constexpr std::size_t pool_round_size = std::numeric_limits<std::uint32_t>::max();
+
+} // namespace mica::internal
+
+// Fixed-size pool running bulk jobs. A job's indices are split evenly between
+// the workers; a worker that runs out steals half of the remaining indices
+// of another one. The thread calling run works as one of the workers.
+class thread_pool {
+public:
+    // Starts threads - 1 threads, at least one worker always exists. When a
+    // thread cannot be started the ones already running are joined and the
+    // std::system_error is rethrown.
+    explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency());
+
+    thread_pool(const thread_pool&) = delete;
+
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool();
+
+    // Number of workers, including the thread calling run
+    std::size_t size() const noexcept;
+
+    // Calls function(index) for every index in [0, count) and returns once
+    // all calls returned. function must not throw. Concurrent calls to run
+    // are serialized. A call made from inside function, on a thread already
+    // running a job of this pool, runs every index on that thread. A job
+    // must not wait for a job of another pool that calls run on this one.
+    template<typename F>
+    requires std::is_nothrow_invocable_v<F&, std::size_t>
+    void run(std::size_t count, F&& function) noexcept;
+
+private:
+    using invoker = void (*)(void*, std::size_t) noexcept;
+
+    // Stops and joins every started thread
+    void stop() noexcept;
+
+    void run_erased(std::size_t count, invoker invoke, void* context) noexcept;
+
+    void run_round(std::size_t first, std::size_t count) noexcept;
+
+    void thread_main(std::size_t worker) noexcept;
+
+    void work(std::size_t worker) noexcept;
+
+    bool take(std::size_t worker, std::size_t& index) noexcept;
+
+    bool steal(std::size_t worker, std::size_t& index) noexcept;
+
+    std::unique_ptr<internal::pool_worker[]> workers_;
+    std::size_t size_;
+    std::vector<std::thread> threads_;
+
+    std::mutex run_mutex_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::uint64_t generation_ = 0;
+    bool stop_ = false;
+
+    invoker invoke_ = nullptr;
+    void* context_ = nullptr;
+    std::size_t first_ = 0;
+    std::atomic<std::size_t> remaining_{0};
+    std::atomic<std::size_t> busy_{0};
+};
+
+} // namespace mica
+
+#include <mica/thread_pool.inl>
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <utility>
+
+namespace mica {
+
+namespace internal {
+
+constexpr std::uint64_t pack_range(std::uint64_t begin, std::uint64_t end) noexcept
+{
+    return (end << 32) | begin;
+}
+
+constexpr std::uint64_t range_begin(std::uint64_t range) noexcept
+{
+    return range & 0xffffffffu;
+}
+
+constexpr std::uint64_t range_end(std::uint64_t range) noexcept
+{
+    return range >> 32;
+}
+
+inline pool_scope::pool_scope(const thread_pool* pool) noexcept
+    : pool(pool),
+      previous(current)
+{
+    current = this;
+}
+
+inline pool_scope::~pool_scope()
+{
+    current = previous;
+}
+
+inline bool pool_scope::inside(const thread_pool* pool) noexcept
+{
+    for (const pool_scope* scope = current; scope != nullptr; scope = scope->previous) {
+        if (scope->pool == pool) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace mica::internal
+
+inline thread_pool::thread_pool(std::size_t threads)
+    : workers_(std::make_unique<internal::pool_worker[]>(std::max<std::size_t>(threads, 1))),
+      size_(std::max<std::size_t>(threads, 1))
+{
+    threads_.reserve(size_ - 1);
+    try {
+        for (std::size_t worker = 1; worker < size_; ++worker) {
+            threads_.emplace_back(&thread_pool::thread_main, this, worker);
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+}
+
+inline thread_pool::~thread_pool()
+{
+    stop();
+}
+
+inline void thread_pool::stop() noexcept
+{
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+inline std::size_t thread_pool::size() const noexcept
+{
+    return size_;
+}
+
+template<typename F>
+requires std::is_nothrow_invocable_v<F&, std::size_t>
+void thread_pool::run(std::size_t count, F&& function) noexcept
+{
+    run_erased(
+        count,
+        [](void* context, std::size_t index) noexcept {
+            (*static_cast<std::remove_reference_t<F>*>(context))(index);
+        },
+        const_cast<void*>(static_cast<const void*>(std::addressof(function)))
+    );
+}
+
+inline void thread_pool::run_erased(std::size_t count, invoker invoke, void* context) noexcept
+{
+    if (count == 0) {
+        return;
+    }
+    // The workers are busy with the outer job, which waits for this call
+    if (internal::pool_scope::inside(this)) {
+        for (std::size_t index = 0; index < count; ++index) {
+            invoke(context, index);
+        }
+        return;
+    }
+    std::lock_guard run_lock(run_mutex_);
+    internal::pool_scope scope(this);
+    invoke_ = invoke;
+    context_ = context;
+    for (std::size_t first = 0; first < count; first += internal::pool_round_size) {
+        run_round(first, std::min(count - first, internal::pool_round_size));
+    }
+}
+
+inline void thread_pool::run_round(std::size_t first, std::size_t count) noexcept
+{
+    first_ = first;
+    remaining_.store(count, std::memory_order_relaxed);
+    for (std::size_t worker = 0; worker < size_; ++worker) {
+        workers_[worker].range.store(
+            internal::pack_range(count * worker / size_, count * (worker + 1) / size_),
+            std::memory_order_relaxed
+        );
+    }
+    // Counted before waking the threads so a fast caller cannot return
+    // while a thread is about to enter the job
+    busy_.store(size_ - 1, std::memory_order_relaxed);
+    {
+        std::lock_guard lock(mutex_);
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    work(0);
+
+    for (std::size_t left = remaining_.load(std::memory_order_acquire); left != 0;
+         left = remaining_.load(std::memory_order_acquire)) {
+        remaining_.wait(left, std::memory_order_acquire);
+    }
+    for (std::size_t busy = busy_.load(std::memory_order_acquire); busy != 0;
+         busy = busy_.load(std::memory_order_acquire)) {
+        busy_.wait(busy, std::memory_order_acquire);
+    }
+}
+
+inline void thread_pool::thread_main(std::size_t worker) noexcept
+{
+    const internal::pool_scope scope(this);
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock lock(mutex_);
+            wake_.wait(lock, [&]() { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+        }
+        work(worker);
+        if (busy_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            busy_.notify_all();
+        }
+    }
+}
+
+inline void thread_pool::work(std::size_t worker) noexcept
+{
+    std::size_t index = 0;
+    while (take(worker, index) || steal(worker, index)) {
+        invoke_(context_, first_ + index);
+        if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            remaining_.notify_all();
+        }
+    }
+}
+
+inline bool thread_pool::take(std::size_t worker, std::size_t& index) noexcept
+{
+    auto& range = workers_[worker].range;
+    std::uint64_t current = range.load(std::memory_order_acquire);
+    for (;;) {
+        const std::uint64_t begin = internal::range_begin(current);
+        const std::uint64_t end = internal::range_end(current);
+        if (begin >= end) {
+            return false;
+        }
+        if (range.compare_exchange_weak(current, internal::pack_range(begin + 1, end), std::memory_order_acq_rel)) {
+            index = begin;
+            return true;
+        }
+    }
+}
+
+// Takes the upper half of another worker's indices, runs the first of them
+// and keeps the rest
+inline bool thread_pool::steal(std::size_t worker, std::size_t& index) noexcept
+{
+    for (std::size_t offset = 1; offset < size_; ++offset) {
+        auto& victim = workers_[(worker + offset) % size_].range;
+        std::uint64_t current = victim.load(std::memory_order_acquire);
+        for (;;) {
+            const std::uint64_t begin = internal::range_begin(current);
+            const std::uint64_t end = internal::range_end(current);
+            if (begin >= end) {
+                break;
+            }
+            const std::uint64_t middle = begin + (end - begin) / 2;
+            if (victim.compare_exchange_weak(current, internal::pack_range(begin, middle), std::memory_order_acq_rel)) {
+                workers_[worker].range.store(internal::pack_range(middle + 1, end), std::memory_order_release);
+                index = middle;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace mica
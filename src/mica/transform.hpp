@@ -0,0 +1,107 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mica/policy.hpp>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace mica {
+
+template<typename E>
+struct indexed_error
+{
+    std::size_t index;
+    E error;
+};
+
+namespace internal {
+
+template<typename T, typename E>
+struct columnar_writer;
+
+} // namespace mica::internal
+
+// Results of a batch stored by column: every value in one contiguous buffer,
+// failures in a bitmap and a sparse list of errors sorted by index. The value
+// of a failed element is left value-initialized. Values are a plain array of
+// T, including bool, so values() is a span and workers of
+// parallel_transform_noexcept write disjoint elements.
+template<typename T, typename E = std::string>
+class columnar_result {
+public:
+    columnar_result() = default;
+
+    columnar_result(const columnar_result& other);
+
+    columnar_result(columnar_result&& other) noexcept;
+
+    columnar_result& operator=(const columnar_result& other);
+
+    columnar_result& operator=(columnar_result&& other) noexcept;
+
+    std::size_t size() const noexcept;
+
+    bool empty() const noexcept;
+
+    std::span<T> values() noexcept;
+
+    std::span<const T> values() const noexcept;
+
+    bool failed(std::size_t index) const noexcept;
+
+    std::size_t failure_count() const noexcept;
+
+    std::span<const indexed_error<E>> errors() const noexcept;
+
+    // Number of values held without reallocating
+    std::size_t capacity() const noexcept;
+
+    void reserve(std::size_t count);
+
+    // Removes every element, keeps the capacity for the next batch
+    void clear() noexcept;
+
+private:
+    friend struct internal::columnar_writer<T, E>;
+
+    // Elements past size_ are value-initialized
+    std::unique_ptr<T[]> values_;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+    std::vector<std::uint64_t> failures_;
+    std::vector<indexed_error<E>> errors_;
+};
+
+// Number of elements transformed inside one try region
+inline constexpr std::size_t transform_chunk_size = 256;
+
+// Appends Func(element) for every element of input to output. Each chunk of
+// elements runs inside a single try region, which is only re-entered after a
+// failure. Exceptions thrown by Func are translated with Policy and recorded
+// for their element; an error is returned only when output itself could not
+// grow, output is then left as it was before the call. A sized input is
+// reserved up front and never grows output past it.
+// Observing policies such as counted and timed see every element as one call
+// and give up the shared try region.
+template<auto Func, typename Policy = std::string, std::ranges::input_range R, typename T>
+requires (
+    std::invocable<decltype(Func), std::ranges::range_reference_t<R>>
+    && error_policy<Policy>
+    && std::default_initializable<T>
+    && std::assignable_from<T&, std::invoke_result_t<decltype(Func), std::ranges::range_reference_t<R>>>
+)
+std::expected<void, policy_error_t<Policy>> transform_noexcept(
+    R&& input,
+    columnar_result<T, policy_error_t<Policy>>& output
+) noexcept;
+
+} // namespace mica
+
+#include <mica/transform.inl>
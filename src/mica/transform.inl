@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace mica {
+
+namespace internal {
+
+inline constexpr std::size_t bitmap_word_bits = 64;
+
+template<typename T, typename E>
+struct columnar_writer
+{
+    // Grows every column by count elements, returns the old size
+    static std::size_t grow(columnar_result<T, E>& output, std::size_t count)
+    {
+        const std::size_t start = output.size_;
+        const std::size_t size = start + count;
+        if (size > output.capacity_) {
+            output.reserve(std::max(size, output.capacity_ * 2));
+        }
+        output.failures_.resize((size + bitmap_word_bits - 1) / bitmap_word_bits);
+        output.size_ = size;
+        return start;
+    }
+
+    // Drops the elements from size on, with their errors
+    static void shrink(columnar_result<T, E>& output, std::size_t size) noexcept
+    {
+        reset(output, size, output.size_);
+        output.size_ = size;
+        output.failures_.resize((size + bitmap_word_bits - 1) / bitmap_word_bits);
+        while (!output.errors_.empty() && output.errors_.back().index >= size) {
+            output.errors_.pop_back();
+        }
+    }
+
+    // Value-initializes the elements in [first, last), they are past the end
+    static void reset(columnar_result<T, E>& output, std::size_t first, std::size_t last) noexcept
+    {
+        for (std::size_t i = first; i < last; ++i) {
+            output.values_[i] = T();
+        }
+    }
+
+    static T& value(columnar_result<T, E>& output, std::size_t index) noexcept
+    {
+        return output.values_[index];
+    }
+
+    static void reserve_errors(columnar_result<T, E>& output, std::size_t count)
+    {
+        output.errors_.reserve(output.errors_.size() + count);
+    }
+
+    static void fail(columnar_result<T, E>& output, std::size_t index, E&& error)
+    {
+        output.errors_.push_back(indexed_error<E>{index, std::move(error)});
+        output.failures_[index / bitmap_word_bits] |= std::uint64_t(1) << (index % bitmap_word_bits);
+    }
+};
+
+} // namespace mica::internal
+
+template<typename T, typename E>
+columnar_result<T, E>::columnar_result(const columnar_result& other)
+    : failures_(other.failures_),
+      errors_(other.errors_)
+{
+    reserve(other.size_);
+    std::copy(other.values_.get(), other.values_.get() + other.size_, values_.get());
+    size_ = other.size_;
+}
+
+template<typename T, typename E>
+columnar_result<T, E>::columnar_result(columnar_result&& other) noexcept
+    : values_(std::move(other.values_)),
+      size_(std::exchange(other.size_, 0)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      failures_(std::move(other.failures_)),
+      errors_(std::move(other.errors_))
+{}
+
+template<typename T, typename E>
+columnar_result<T, E>& columnar_result<T, E>::operator=(const columnar_result& other)
+{
+    if (this != &other) {
+        columnar_result copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename E>
+columnar_result<T, E>& columnar_result<T, E>::operator=(columnar_result&& other) noexcept
+{
+    if (this != &other) {
+        values_ = std::move(other.values_);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+        failures_ = std::move(other.failures_);
+        errors_ = std::move(other.errors_);
+    }
+    return *this;
+}
+
+template<typename T, typename E>
+std::size_t columnar_result<T, E>::size() const noexcept
+{
+    return size_;
+}
+
+template<typename T, typename E>
+bool columnar_result<T, E>::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+template<typename T, typename E>
+std::span<T> columnar_result<T, E>::values() noexcept
+{
+    return std::span<T>(values_.get(), size_);
+}
+
+template<typename T, typename E>
+std::span<const T> columnar_result<T, E>::values() const noexcept
+{
+    return std::span<const T>(values_.get(), size_);
+}
+
+template<typename T, typename E>
+bool columnar_result<T, E>::failed(std::size_t index) const noexcept
+{
+    using internal::bitmap_word_bits;
+    return (failures_[index / bitmap_word_bits] >> (index % bitmap_word_bits)) & 1;
+}
+
+template<typename T, typename E>
+std::size_t columnar_result<T, E>::failure_count() const noexcept
+{
+    return errors_.size();
+}
+
+template<typename T, typename E>
+std::span<const indexed_error<E>> columnar_result<T, E>::errors() const noexcept
+{
+    return errors_;
+}
+
+template<typename T, typename E>
+std::size_t columnar_result<T, E>::capacity() const noexcept
+{
+    return capacity_;
+}
+
+template<typename T, typename E>
+void columnar_result<T, E>::reserve(std::size_t count)
+{
+    if (count > capacity_) {
+        auto values = std::make_unique<T[]>(count);
+        std::move(values_.get(), values_.get() + size_, values.get());
+        values_ = std::move(values);
+        capacity_ = count;
+    }
+    failures_.reserve((count + internal::bitmap_word_bits - 1) / internal::bitmap_word_bits);
+}
+
+template<typename T, typename E>
+void columnar_result<T, E>::clear() noexcept
+{
+    internal::columnar_writer<T, E>::reset(*this, 0, size_);
+    size_ = 0;
+    failures_.clear();
+    errors_.clear();
+}
+
+namespace internal {
+
+// Stores Func(*it) into values[i] for at most count elements. The elements
+// run inside one guard, re-entered only after an element throws; the error
+// of a failed element is passed to on_failure with its offset. A policy with
+// an observer guards every element instead, so each one is a call. Returns
+// the number of elements consumed.
+template<auto Func, typename Policy, typename It, typename Sentinel, typename T, typename OnFailure>
+std::size_t transform_chunk(It& it, const Sentinel& last, T* values, std::size_t count, OnFailure&& on_failure)
+{
+    std::size_t offset = 0;
+    if constexpr (!std::is_same_v<policy_observer_t<Policy>, no_observer>) {
+        for (; offset < count && it != last; ++offset, ++it) {
+            auto&& exp = guard<Policy, void>([&]() {
+                values[offset] = std::invoke(Func, *it);
+            });
+            if (!exp.has_value()) [[unlikely]] {
+                on_failure(offset, std::move(exp).error());
+            }
+        }
+    } else {
+        while (offset < count && it != last) {
+            auto&& exp = guard<Policy, void>([&]() {
+                for (; offset < count && it != last; ++offset, ++it) {
+                    values[offset] = std::invoke(Func, *it);
+                }
+            });
+            if (!exp.has_value()) [[unlikely]] {
+                on_failure(offset, std::move(exp).error());
+                ++offset;
+                ++it;
+            }
+        }
+    }
+    return offset;
+}
+
+} // namespace mica::internal
+
+template<auto Func, typename Policy, std::ranges::input_range R, typename T>
+requires (
+    std::invocable<decltype(Func), std::ranges::range_reference_t<R>>
+    && error_policy<Policy>
+    && std::default_initializable<T>
+    && std::assignable_from<T&, std::invoke_result_t<decltype(Func), std::ranges::range_reference_t<R>>>
+)
+std::expected<void, policy_error_t<Policy>> transform_noexcept(
+    R&& input,
+    columnar_result<T, policy_error_t<Policy>>& output
+) noexcept
+{
+    using E = policy_error_t<Policy>;
+    using writer = internal::columnar_writer<T, E>;
+    const std::size_t start = output.size();
+    // Only failures to grow output reach this guard, exceptions thrown by Func
+    // are handled per chunk
+    auto&& exp = internal::guard<internal::unobserved<Policy>, void>([&]() {
+        // A sized input grows output up to the reservation and no further
+        std::size_t remaining = transform_chunk_size;
+        if constexpr (std::ranges::sized_range<R>) {
+            remaining = static_cast<std::size_t>(std::ranges::size(input));
+            output.reserve(start + remaining);
+        }
+        auto it = std::ranges::begin(input);
+        const auto last = std::ranges::end(input);
+        while (it != last) {
+            const std::size_t count = std::min(transform_chunk_size, remaining);
+            const std::size_t chunk_start = writer::grow(output, count);
+            const std::size_t consumed = internal::transform_chunk<Func, Policy>(
+                it,
+                last,
+                &writer::value(output, chunk_start),
+                count,
+                [&](std::size_t offset, E&& error) {
+                    writer::fail(output, chunk_start + offset, std::move(error));
+                }
+            );
+            if constexpr (std::ranges::sized_range<R>) {
+                remaining -= consumed;
+            }
+            if (consumed < count) {
+                writer::shrink(output, chunk_start + consumed);
+            }
+        }
+    });
+    if (!exp.has_value()) [[unlikely]] {
+        writer::shrink(output, start);
+    }
+    return exp;
+}
+
+} // namespace mica
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <mica/macro.hpp>
+
+// Only the MICA_TRY macros, without the declarations they expand to. Code
+// that imports the mica module includes this header for the macros; code
+// that includes the mica headers gets them from mica/try.hpp. The
+// expansions name std::expected, std::unexpected and std::move, which the
+// including file provides.
+
+#ifndef MICA_COUNTERS
+#define MICA_COUNTERS 0
+#endif
+
+#if MICA_COUNTERS
+#define _MICA_INTERNAL_COUNT_TRY(failed_) ::mica::internal::count_call<MICA_CALL_SITE>(failed_)
+#else
+#define _MICA_INTERNAL_COUNT_TRY(failed_) static_cast<void>(0)
+#endif
+
+// With MICA_COUNTERS every macro below counts how often it was evaluated and
+// how often it propagated an error, keyed on its call site.
+
+#define _MICA_INTERNAL_TRY(result_, expr_, tmp_exp_var_) \
+do { \
+    auto&& tmp_exp_var_ = (expr_); \
+    static_assert(mica::is_expected_v<std::remove_reference_t<decltype(tmp_exp_var_)>>); \
+    static_assert(std::is_same_v< \
+        std::remove_reference_t<decltype(result_)>, \
+        typename std::remove_reference_t<decltype(tmp_exp_var_)>::value_type> \
+    ); \
+    _MICA_INTERNAL_COUNT_TRY(!tmp_exp_var_.has_value()); \
+    if (!tmp_exp_var_.has_value()) [[unlikely]] { \
+        return std::unexpected(std::move(tmp_exp_var_).error()); \
+    } \
+    result_ = std::move(tmp_exp_var_).value(); \
+} while (0)
+
+#define MICA_TRY(result_, expr_) \
+    _MICA_INTERNAL_TRY(result_, expr_, MICA_TMP_VAR_DEFAULT)
+
+#define _MICA_INTERNAL_TRY_VOID(expr_, tmp_exp_var_) \
+do { \
+    auto&& tmp_exp_var_ = (expr_); \
+    static_assert(mica::is_expected_v<std::remove_reference_t<decltype(tmp_exp_var_)>>); \
+    static_assert(std::is_void_v<typename std::remove_reference_t<decltype(tmp_exp_var_)>::value_type>); \
+    _MICA_INTERNAL_COUNT_TRY(!tmp_exp_var_.has_value()); \
+    if (!tmp_exp_var_.has_value()) [[unlikely]] { \
+        return std::unexpected(std::move(tmp_exp_var_).error()); \
+    } \
+} while (0)
+
+#define MICA_TRY_VOID(expr_) \
+    _MICA_INTERNAL_TRY_VOID(expr_, MICA_TMP_VAR_DEFAULT)
+
+#define _MICA_INTERNAL_TRY_STATIC(result_, expr_, err_msg_, tmp_exp_var_) \
+do { \
+    auto&& tmp_exp_var_ = (expr_); \
+    static_assert(mica::is_expected_v<std::remove_reference_t<decltype(tmp_exp_var_)>>); \
+    static_assert(std::is_same_v< \
+        std::remove_reference_t<decltype(result_)>, \
+        typename std::remove_reference_t<decltype(tmp_exp_var_)>::value_type> \
+    ); \
+    static_assert(mica::is_string_literal_v<decltype(err_msg_)>); \
+    _MICA_INTERNAL_COUNT_TRY(!tmp_exp_var_.has_value()); \
+    if (!tmp_exp_var_.has_value()) [[unlikely]] { \
+        return std::unexpected(err_msg_); \
+    } \
+    result_ = std::move(tmp_exp_var_).value(); \
+} while (0)
+
+#define MICA_TRY_STATIC(result_, expr_, err_msg_) \
+    _MICA_INTERNAL_TRY_STATIC(result_, expr_, err_msg_, MICA_TMP_VAR_DEFAULT)
+
+#define _MICA_INTERNAL_TRY_STATIC_VOID(expr_, err_msg_, tmp_exp_var_) \
+do { \
+    auto&& tmp_exp_var_ = (expr_); \
+    static_assert(mica::is_expected_v<std::remove_reference_t<decltype(tmp_exp_var_)>>); \
+    static_assert(std::is_void_v<typename std::remove_reference_t<decltype(tmp_exp_var_)>::value_type>); \
+    static_assert(mica::is_string_literal_v<decltype(err_msg_)>); \
+    _MICA_INTERNAL_COUNT_TRY(!tmp_exp_var_.has_value()); \
+    if (!tmp_exp_var_.has_value()) [[unlikely]] { \
+        return std::unexpected(err_msg_); \
+    } \
+} while (0)
+
+#define MICA_TRY_STATIC_VOID(expr_, err_msg_) \
+    _MICA_INTERNAL_TRY_STATIC_VOID(expr_, err_msg_, MICA_TMP_VAR_DEFAULT)
+
+// Expression form of MICA_TRY, evaluates to the value of expr_. The result
+// is move constructed once from the expected, so it works for types that are
+// not default constructible:
+//     auto value = MICA_TRY_EXPR(parse(text));
+// Relies on statement expressions, supported by GCC and Clang.
+#define _MICA_INTERNAL_TRY_EXPR(expr_, tmp_exp_var_) \
+__extension__ ({ \
+    auto&& tmp_exp_var_ = (expr_); \
+    static_assert(mica::is_expected_v<std::remove_reference_t<decltype(tmp_exp_var_)>>); \
+    static_assert(!std::is_void_v<typename std::remove_reference_t<decltype(tmp_exp_var_)>::value_type>); \
+    _MICA_INTERNAL_COUNT_TRY(!tmp_exp_var_.has_value()); \
+    if (!tmp_exp_var_.has_value()) [[unlikely]] { \
+        return std::unexpected(std::move(tmp_exp_var_).error()); \
+    } \
+    std::move(tmp_exp_var_).value(); \
+})
+
+#define MICA_TRY_EXPR(expr_) \
+    _MICA_INTERNAL_TRY_EXPR(expr_, MICA_TMP_VAR_DEFAULT)
+
+// Declares decl_ in the enclosing scope, initialized from the value of expr_.
+// With a value declaration the result is move constructed once, with auto&&
+// it binds to the value stored in the expected and nothing is moved:
+//     MICA_TRY_DECL(auto&& value, parse(text));
+// Expands to several statements, brace it when used as the body of an if.
+// The expected is held in a temporary of the enclosing scope, named uniquely
+// so that several expansions can share a line.
+#define _MICA_INTERNAL_TRY_DECL(decl_, expr_, tmp_exp_var_) \
+    auto&& tmp_exp_var_ = (expr_); \
+    static_assert(mica::is_expected_v<std::remove_reference_t<decltype(tmp_exp_var_)>>); \
+    static_assert(!std::is_void_v<typename std::remove_reference_t<decltype(tmp_exp_var_)>::value_type>); \
+    _MICA_INTERNAL_COUNT_TRY(!tmp_exp_var_.has_value()); \
+    if (!tmp_exp_var_.has_value()) [[unlikely]] { \
+        return std::unexpected(std::move(tmp_exp_var_).error()); \
+    } \
+    decl_ = *std::move(tmp_exp_var_)
+
+#define MICA_TRY_DECL(decl_, expr_) \
+    _MICA_INTERNAL_TRY_DECL(decl_, expr_, MICA_TMP_VAR_UNIQUE)
+
+// Like MICA_TRY, and on error records err_msg_ and the location of the macro
+// as a context frame of the error. The enclosing function returns an
+// expected whose error type is mica::with_context, which stores up to
+// with_context<E>::capacity frames.
+#define _MICA_INTERNAL_TRY_CONTEXT(result_, expr_, err_msg_, tmp_exp_var_) \
+do { \
+    auto&& tmp_exp_var_ = (expr_); \
+    static_assert(mica::is_expected_v<std::remove_reference_t<decltype(tmp_exp_var_)>>); \
+    static_assert(std::is_same_v< \
+        std::remove_reference_t<decltype(result_)>, \
+        typename std::remove_reference_t<decltype(tmp_exp_var_)>::value_type> \
+    ); \
+    static_assert(mica::is_string_literal_v<decltype(err_msg_)>); \
+    _MICA_INTERNAL_COUNT_TRY(!tmp_exp_var_.has_value()); \
+    if (!tmp_exp_var_.has_value()) [[unlikely]] { \
+        return mica::internal::propagate_context( \
+            std::move(tmp_exp_var_).error(), \
+            err_msg_, \
+            std::source_location::current() \
+        ); \
+    } \
+    result_ = std::move(tmp_exp_var_).value(); \
+} while (0)
+
+#define MICA_TRY_CONTEXT(result_, expr_, err_msg_) \
+    _MICA_INTERNAL_TRY_CONTEXT(result_, expr_, err_msg_, MICA_TMP_VAR_DEFAULT)
+
+#define _MICA_INTERNAL_TRY_CONTEXT_VOID(expr_, err_msg_, tmp_exp_var_) \
+do { \
+    auto&& tmp_exp_var_ = (expr_); \
+    static_assert(mica::is_expected_v<std::remove_reference_t<decltype(tmp_exp_var_)>>); \
+    static_assert(std::is_void_v<typename std::remove_reference_t<decltype(tmp_exp_var_)>::value_type>); \
+    static_assert(mica::is_string_literal_v<decltype(err_msg_)>); \
+    _MICA_INTERNAL_COUNT_TRY(!tmp_exp_var_.has_value()); \
+    if (!tmp_exp_var_.has_value()) [[unlikely]] { \
+        return mica::internal::propagate_context( \
+            std::move(tmp_exp_var_).error(), \
+            err_msg_, \
+            std::source_location::current() \
+        ); \
+    } \
+} while (0)
+
+#define MICA_TRY_CONTEXT_VOID(expr_, err_msg_) \
+    _MICA_INTERNAL_TRY_CONTEXT_VOID(expr_, err_msg_, MICA_TMP_VAR_DEFAULT)
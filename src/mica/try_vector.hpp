@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <mica/allocator.hpp>
+#include <mica/error_traits.hpp>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace mica {
+
+// Vector whose growth reports running out of memory as a value. Every
+// function that may allocate returns std::expected<void, E> and leaves the
+// vector unchanged on failure, e.g.
+//     MICA_TRY_VOID(values.try_push_back(value));
+// Exceptions thrown by the constructors of T propagate. Copying would
+// allocate, so try_vector is move-only.
+template<typename T, try_allocator Allocator = heap_allocator>
+class try_vector {
+    static_assert(std::is_nothrow_move_constructible_v<T>, "try_vector requires T to be nothrow move constructible");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    try_vector() = default;
+
+    explicit try_vector(Allocator allocator) noexcept;
+
+    try_vector(const try_vector&) = delete;
+
+    try_vector(try_vector&& other) noexcept;
+
+    try_vector& operator=(const try_vector&) = delete;
+
+    try_vector& operator=(try_vector&& other) noexcept;
+
+    ~try_vector();
+
+    template<error_type E = std::string>
+    std::expected<void, E> try_reserve(std::size_t capacity) noexcept;
+
+    // New elements are value-initialized
+    template<error_type E = std::string>
+    std::expected<void, E> try_resize(std::size_t size)
+        noexcept(std::is_nothrow_default_constructible_v<T>);
+
+    template<error_type E = std::string>
+    std::expected<void, E> try_resize(std::size_t size, const T& value)
+        noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    template<error_type E = std::string>
+    std::expected<void, E> try_push_back(const T& value)
+        noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    template<error_type E = std::string>
+    std::expected<void, E> try_push_back(T&& value) noexcept;
+
+    template<error_type E = std::string, typename... Args>
+    requires std::is_constructible_v<T, Args&&...>
+    std::expected<void, E> try_emplace_back(Args&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, Args&&...>);
+
+    void pop_back() noexcept;
+
+    // Keeps the capacity
+    void clear() noexcept;
+
+    T& operator[](std::size_t index) noexcept;
+
+    const T& operator[](std::size_t index) const noexcept;
+
+    T& front() noexcept;
+
+    const T& front() const noexcept;
+
+    T& back() noexcept;
+
+    const T& back() const noexcept;
+
+    T* data() noexcept;
+
+    const T* data() const noexcept;
+
+    iterator begin() noexcept;
+
+    const_iterator begin() const noexcept;
+
+    iterator end() noexcept;
+
+    const_iterator end() const noexcept;
+
+    std::size_t size() const noexcept;
+
+    std::size_t capacity() const noexcept;
+
+    bool empty() const noexcept;
+
+    static constexpr std::size_t max_size() noexcept;
+
+    operator std::span<T>() noexcept;
+
+    operator std::span<const T>() const noexcept;
+
+private:
+    // Capacity for at least size elements, doubling the current one
+    template<error_type E>
+    std::expected<void, E> grow(std::size_t size) noexcept;
+
+    void release() noexcept;
+
+    T* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+    [[no_unique_address]] Allocator allocator_;
+};
+
+} // namespace mica
+
+#include <mica/try_vector.inl>
@@ -0,0 +1,300 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace mica {
+
+namespace internal {
+
+template<typename T, typename Allocator>
+T* allocate_elements(Allocator& allocator, std::size_t count) noexcept
+{
+    return static_cast<T*>(allocator.allocate(count * sizeof(T), alignof(T)));
+}
+
+// Moves count elements from source to the uninitialized destination and
+// destroys them in source
+template<typename T>
+void relocate(T* source, std::size_t count, T* destination) noexcept
+{
+    std::uninitialized_move_n(source, count, destination);
+    std::destroy_n(source, count);
+}
+
+} // namespace mica::internal
+
+template<typename T, try_allocator Allocator>
+try_vector<T, Allocator>::try_vector(Allocator allocator) noexcept
+    : allocator_(std::move(allocator))
+{}
+
+template<typename T, try_allocator Allocator>
+try_vector<T, Allocator>::try_vector(try_vector&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      allocator_(std::move(other.allocator_))
+{}
+
+template<typename T, try_allocator Allocator>
+try_vector<T, Allocator>& try_vector<T, Allocator>::operator=(try_vector&& other) noexcept
+{
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+        allocator_ = std::move(other.allocator_);
+    }
+    return *this;
+}
+
+template<typename T, try_allocator Allocator>
+try_vector<T, Allocator>::~try_vector()
+{
+    release();
+}
+
+template<typename T, try_allocator Allocator>
+template<error_type E>
+std::expected<void, E> try_vector<T, Allocator>::try_reserve(std::size_t capacity) noexcept
+{
+    if (capacity <= capacity_) {
+        return {};
+    }
+    if (capacity > max_size()) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::length_error));
+    }
+    T* data = internal::allocate_elements<T>(allocator_, capacity);
+    if (data == nullptr) [[unlikely]] {
+        return std::unexpected(error_traits<E>::from_code(errc::bad_alloc));
+    }
+    internal::relocate(data_, size_, data);
+    if (data_ != nullptr) {
+        allocator_.deallocate(data_, capacity_ * sizeof(T), alignof(T));
+    }
+    data_ = data;
+    capacity_ = capacity;
+    return {};
+}
+
+template<typename T, try_allocator Allocator>
+template<error_type E>
+std::expected<void, E> try_vector<T, Allocator>::try_resize(std::size_t size)
+    noexcept(std::is_nothrow_default_constructible_v<T>)
+{
+    if (size > capacity_) {
+        auto&& grown = grow<E>(size);
+        if (!grown.has_value()) [[unlikely]] {
+            return std::unexpected(std::move(grown).error());
+        }
+    }
+    if (size > size_) {
+        std::uninitialized_value_construct(data_ + size_, data_ + size);
+    } else {
+        std::destroy(data_ + size, data_ + size_);
+    }
+    size_ = size;
+    return {};
+}
+
+template<typename T, try_allocator Allocator>
+template<error_type E>
+std::expected<void, E> try_vector<T, Allocator>::try_resize(std::size_t size, const T& value)
+    noexcept(std::is_nothrow_copy_constructible_v<T>)
+{
+    if (size > capacity_) {
+        // value may be an element, copy it before they move
+        T copy(value);
+        auto&& grown = grow<E>(size);
+        if (!grown.has_value()) [[unlikely]] {
+            return std::unexpected(std::move(grown).error());
+        }
+        std::uninitialized_fill(data_ + size_, data_ + size, copy);
+    } else if (size > size_) {
+        std::uninitialized_fill(data_ + size_, data_ + size, value);
+    } else {
+        std::destroy(data_ + size, data_ + size_);
+    }
+    size_ = size;
+    return {};
+}
+
+template<typename T, try_allocator Allocator>
+template<error_type E>
+std::expected<void, E> try_vector<T, Allocator>::try_push_back(const T& value)
+    noexcept(std::is_nothrow_copy_constructible_v<T>)
+{
+    return try_emplace_back<E>(value);
+}
+
+template<typename T, try_allocator Allocator>
+template<error_type E>
+std::expected<void, E> try_vector<T, Allocator>::try_push_back(T&& value) noexcept
+{
+    return try_emplace_back<E>(std::move(value));
+}
+
+template<typename T, try_allocator Allocator>
+template<error_type E, typename... Args>
+requires std::is_constructible_v<T, Args&&...>
+std::expected<void, E> try_vector<T, Allocator>::try_emplace_back(Args&&... args)
+    noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+{
+    if (size_ == capacity_) [[unlikely]] {
+        // args may refer to elements, construct before they move
+        T value(std::forward<Args>(args)...);
+        auto&& grown = grow<E>(size_ + 1);
+        if (!grown.has_value()) [[unlikely]] {
+            return std::unexpected(std::move(grown).error());
+        }
+        ::new (static_cast<void*>(data_ + size_)) T(std::move(value));
+    } else {
+        ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+    }
+    ++size_;
+    return {};
+}
+
+template<typename T, try_allocator Allocator>
+void try_vector<T, Allocator>::pop_back() noexcept
+{
+    --size_;
+    std::destroy_at(data_ + size_);
+}
+
+template<typename T, try_allocator Allocator>
+void try_vector<T, Allocator>::clear() noexcept
+{
+    std::destroy_n(data_, size_);
+    size_ = 0;
+}
+
+template<typename T, try_allocator Allocator>
+T& try_vector<T, Allocator>::operator[](std::size_t index) noexcept
+{
+    return data_[index];
+}
+
+template<typename T, try_allocator Allocator>
+const T& try_vector<T, Allocator>::operator[](std::size_t index) const noexcept
+{
+    return data_[index];
+}
+
+template<typename T, try_allocator Allocator>
+T& try_vector<T, Allocator>::front() noexcept
+{
+    return data_[0];
+}
+
+template<typename T, try_allocator Allocator>
+const T& try_vector<T, Allocator>::front() const noexcept
+{
+    return data_[0];
+}
+
+template<typename T, try_allocator Allocator>
+T& try_vector<T, Allocator>::back() noexcept
+{
+    return data_[size_ - 1];
+}
+
+template<typename T, try_allocator Allocator>
+const T& try_vector<T, Allocator>::back() const noexcept
+{
+    return data_[size_ - 1];
+}
+
+template<typename T, try_allocator Allocator>
+T* try_vector<T, Allocator>::data() noexcept
+{
+    return data_;
+}
+
+template<typename T, try_allocator Allocator>
+const T* try_vector<T, Allocator>::data() const noexcept
+{
+    return data_;
+}
+
+template<typename T, try_allocator Allocator>
+auto try_vector<T, Allocator>::begin() noexcept -> iterator
+{
+    return data_;
+}
+
+template<typename T, try_allocator Allocator>
+auto try_vector<T, Allocator>::begin() const noexcept -> const_iterator
+{
+    return data_;
+}
+
+template<typename T, try_allocator Allocator>
+auto try_vector<T, Allocator>::end() noexcept -> iterator
+{
+    return data_ + size_;
+}
+
+template<typename T, try_allocator Allocator>
+auto try_vector<T, Allocator>::end() const noexcept -> const_iterator
+{
+    return data_ + size_;
+}
+
+template<typename T, try_allocator Allocator>
+std::size_t try_vector<T, Allocator>::size() const noexcept
+{
+    return size_;
+}
+
+template<typename T, try_allocator Allocator>
+std::size_t try_vector<T, Allocator>::capacity() const noexcept
+{
+    return capacity_;
+}
+
+template<typename T, try_allocator Allocator>
+bool try_vector<T, Allocator>::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+template<typename T, try_allocator Allocator>
+constexpr std::size_t try_vector<T, Allocator>::max_size() noexcept
+{
+    return static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(T);
+}
+
+template<typename T, try_allocator Allocator>
+try_vector<T, Allocator>::operator std::span<T>() noexcept
+{
+    return std::span<T>(data_, size_);
+}
+
+template<typename T, try_allocator Allocator>
+try_vector<T, Allocator>::operator std::span<const T>() const noexcept
+{
+    return std::span<const T>(data_, size_);
+}
+
+template<typename T, try_allocator Allocator>
+template<error_type E>
+std::expected<void, E> try_vector<T, Allocator>::grow(std::size_t size) noexcept
+{
+    const std::size_t doubled = capacity_ > max_size() / 2 ? max_size() : 2 * capacity_;
+    return try_reserve<E>(std::max(size, doubled));
+}
+
+template<typename T, try_allocator Allocator>
+void try_vector<T, Allocator>::release() noexcept
+{
+    std::destroy_n(data_, size_);
+    if (data_ != nullptr) {
+        allocator_.deallocate(data_, capacity_ * sizeof(T), alignof(T));
+    }
+}
+
+} // namespace mica
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <concepts>
 #include <cstddef>
 #include <expected>
 #include <string>
@@ -39,4 +40,22 @@ constexpr bool is_string_literal_v = is_string_literal<T>::value;
 //template<typename T>
 //struct is_noncapturing_lambda
 
+namespace internal {
+
+template<typename T>
+concept character = std::same_as<std::remove_cv_t<T>, char>
+    || std::same_as<std::remove_cv_t<T>, wchar_t>
+    || std::same_as<std::remove_cv_t<T>, char8_t>
+    || std::same_as<std::remove_cv_t<T>, char16_t>
+    || std::same_as<std::remove_cv_t<T>, char32_t>;
+
+// True when Func is a throwing std accessor replaced by mica/checked.hpp.
+// Specialized by mica/accessor_traits.hpp, so make_noexcept only rejects the
+// accessors when checked.hpp is included.
+template<auto Func, typename = void>
+struct throwing_accessor : std::false_type
+{};
+
+} // namespace mica::internal
+
 } // namespace mica
@@ -0,0 +1,9 @@
+set(MICA_CODEGEN_SOURCES
+    happy_path.cpp
+)
+
+prepend_paths(
+    "${MICA_CODEGEN_SOURCES}"
+    "src/mica_codegen"
+    "MICA_CODEGEN_SOURCES"
+)
@@ -0,0 +1,99 @@
+# Inspects the disassembly of OBJECT and fails when the happy path of a probe
+# function regressed. Probes are the functions of namespace NAMESPACE.
+#
+# The hot part of each probe (its symbol in .text) must not call the allocator
+# or the C++ ABI runtime (__cxa_*), and must not call through a pointer. Its
+# catch handlers must have been outlined into a cold clone in .text.unlikely.
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DOBJECT=<object file> -DNAMESPACE=<namespace> -P check_codegen.cmake
+
+cmake_minimum_required(VERSION 4.0.0)
+
+foreach(var IN ITEMS OBJDUMP OBJECT NAMESPACE)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+execute_process(
+    COMMAND "${OBJDUMP}" --disassemble --reloc --demangle --no-show-raw-insn "${OBJECT}"
+    OUTPUT_VARIABLE disassembly
+    ERROR_VARIABLE objdump_error
+    RESULT_VARIABLE objdump_result
+)
+if(NOT objdump_result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${OBJECT}: ${objdump_error}")
+endif()
+
+# Brackets ([abi:cxx11], [clone .cold]) and semicolons would break list splitting
+string(REPLACE ";" "<semicolon>" disassembly "${disassembly}")
+string(REPLACE "[" "<" disassembly "${disassembly}")
+string(REPLACE "]" ">" disassembly "${disassembly}")
+string(REPLACE "\n" ";" lines "${disassembly}")
+
+set(forbidden_calls "(operator new|operator delete|malloc|calloc|realloc|free|__cxa_[a-z_]+)")
+
+set(section "")
+set(symbol "")
+set(probes "")
+set(cold_handlers "")
+set(failures "")
+foreach(line IN LISTS lines)
+    if(line MATCHES "^Disassembly of section (.+):$")
+        set(section "${CMAKE_MATCH_1}")
+        continue()
+    endif()
+    if(line MATCHES "^[0-9a-f]+ <(.+)>:$")
+        set(symbol "${CMAKE_MATCH_1}")
+        if(NOT symbol MATCHES "^${NAMESPACE}::([a-z_0-9]+)")
+            set(symbol "")
+            continue()
+        endif()
+        set(probe "${CMAKE_MATCH_1}")
+        if(section STREQUAL ".text" AND NOT symbol MATCHES "<clone ")
+            list(APPEND probes "${probe}")
+            set(symbol_kind "hot")
+        elseif(section MATCHES "^\\.text\\.unlikely" OR symbol MATCHES "<clone \\.cold")
+            set(symbol_kind "cold")
+        else()
+            set(symbol_kind "other")
+        endif()
+        continue()
+    endif()
+    if(symbol STREQUAL "")
+        continue()
+    endif()
+    # x86 call *<operand>, AArch64 blr <register>
+    if(symbol_kind STREQUAL "hot" AND line MATCHES "^ *[0-9a-f]+:[ \t]+(callq?[ \t]+\\*|blr[ \t])")
+        list(APPEND failures "${probe}: happy path has an indirect call")
+        continue()
+    endif()
+    if(NOT line MATCHES "R_[A-Z0-9_]+[ \t]+(.+)$")
+        continue()
+    endif()
+    set(target "${CMAKE_MATCH_1}")
+    if(symbol_kind STREQUAL "hot" AND target MATCHES "^${forbidden_calls}[^a-z_]")
+        list(APPEND failures "${probe}: happy path calls ${CMAKE_MATCH_1}")
+    elseif(symbol_kind STREQUAL "cold" AND target MATCHES "^__cxa_begin_catch")
+        list(APPEND cold_handlers "${probe}")
+    endif()
+endforeach()
+
+if(probes STREQUAL "")
+    message(FATAL_ERROR "No ${NAMESPACE} functions found in ${OBJECT}")
+endif()
+
+list(REMOVE_DUPLICATES probes)
+foreach(probe IN LISTS probes)
+    if(NOT probe IN_LIST cold_handlers)
+        list(APPEND failures "${probe}: catch handlers are not in a cold section")
+    endif()
+endforeach()
+
+if(NOT failures STREQUAL "")
+    list(JOIN failures "\n  " report)
+    message(FATAL_ERROR "Codegen regressions in ${OBJECT}:\n  ${report}")
+endif()
+
+list(LENGTH probes probe_count)
+message(STATUS "${probe_count} ${NAMESPACE} functions have an allocation and runtime free happy path")
@@ -0,0 +1,88 @@
+// Representative wrappers whose object code is inspected by check_codegen.cmake.
+// The wrapped functions are only declared so the compiler cannot see whether
+// they throw, which is the situation make_noexcept exists for.
+
+#include <expected>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace mica_codegen {
+
+int parse(int value);
+
+int scale(int value);
+
+double scale(double value);
+
+class parser {
+public:
+    int parse(int value) const;
+
+    int scale(int value) const;
+
+    double scale(double value) const;
+};
+
+struct invalid_argument_message
+{
+    mica::error operator()() const noexcept
+    {
+        return mica::errc::invalid_argument;
+    }
+};
+
+using translated_policy = mica::translators<
+    mica::on<std::invalid_argument, invalid_argument_message>
+>;
+
+std::expected<int, std::string> free_function_string(int value) noexcept
+{
+    return mica::make_noexcept<parse>(value);
+}
+
+std::expected<int, mica::error> free_function_error(int value) noexcept
+{
+    return mica::make_noexcept<parse, mica::error>(value);
+}
+
+std::expected<int, mica::error> free_function_translated(int value) noexcept
+{
+    return mica::make_noexcept<parse, translated_policy>(value);
+}
+
+std::expected<int, mica::error> member_function_error(const parser& p, int value) noexcept
+{
+    return mica::make_noexcept<&parser::parse, mica::error>(p, value);
+}
+
+std::expected<int, mica::error> lifted_overload_error(int value) noexcept
+{
+    return mica::make_noexcept<MICA_LIFT(scale), mica::error>(value);
+}
+
+std::expected<int, mica::error> lifted_member_error(const parser& p, int value) noexcept
+{
+    return mica::make_noexcept<MICA_LIFT_MEMBER(scale), mica::error>(p, value);
+}
+
+std::expected<int, mica::error> lifted_stoi_error(const std::string& text) noexcept
+{
+    return mica::make_noexcept<MICA_LIFT(std::stoi), mica::error>(text);
+}
+
+std::expected<int, mica::error> capturing_lambda_error(int value, int offset) noexcept
+{
+    return mica::make_noexcept<mica::error>([offset](int v) { return parse(v + offset); }, value);
+}
+
+std::expected<int, mica::error> try_chain(int value) noexcept
+{
+    int first = 0;
+    MICA_TRY(first, free_function_error(value));
+    int second = 0;
+    MICA_TRY(second, free_function_error(first));
+    return first + second;
+}
+
+} // namespace mica_codegen
@@ -0,0 +1,9 @@
+set(MICA_MODULE_TEST_SOURCES
+    import_test.cpp
+)
+
+prepend_paths(
+    "${MICA_MODULE_TEST_SOURCES}"
+    "src/mica_module"
+    "MICA_MODULE_TEST_SOURCES"
+)
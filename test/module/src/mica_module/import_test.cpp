@@ -0,0 +1,74 @@
+// Imports the mica module the way its header comment documents, with the
+// macros from the headers of macros only. Fails to compile if an expansion
+// names a declaration the module does not export.
+#include <expected>
+#include <string>
+#include <utility>
+#include <mica/lift.hpp>
+#include <mica/try_macros.hpp>
+
+import mica;
+
+namespace mica_module {
+
+namespace {
+
+std::expected<int, std::string> parse(const std::string& text) noexcept
+{
+    return mica::make_noexcept<MICA_LIFT(std::stoi)>(text);
+}
+
+std::expected<int, std::string> parse_counted(const std::string& text) noexcept
+{
+    using site = MICA_CALL_SITE;
+    return mica::make_noexcept<MICA_LIFT(std::stoi), mica::counted<std::string, site>>(text);
+}
+
+std::expected<void, std::string> check(const std::string& text) noexcept
+{
+    MICA_TRY_DECL([[maybe_unused]] int value, parse(text));
+    return {};
+}
+
+std::expected<int, std::string> sum(const std::string& first, const std::string& second) noexcept
+{
+    int output = 0;
+    MICA_TRY(output, parse(first));
+    MICA_TRY_VOID(check(second));
+    int value = 0;
+    MICA_TRY(value, parse_counted(second));
+    return output + value + MICA_TRY_EXPR(parse(first));
+}
+
+std::expected<int, std::string> sum_static(const std::string& text) noexcept
+{
+    int output = 0;
+    MICA_TRY_STATIC(output, parse(text), "parsing");
+    MICA_TRY_STATIC_VOID(check(text), "parsing");
+    return output;
+}
+
+std::expected<int, mica::with_context<std::string>> sum_context(const std::string& text) noexcept
+{
+    int output = 0;
+    MICA_TRY_CONTEXT(output, parse(text), "parsing");
+    MICA_TRY_CONTEXT_VOID(check(text), "parsing");
+    return output;
+}
+
+} // unnamed namespace
+
+} // namespace mica_module
+
+int main()
+{
+    using namespace mica_module;
+    int failures = 0;
+    failures += sum("1", "2") != 4;
+    failures += sum("1", "x").has_value();
+    failures += sum_static("3") != 3;
+    failures += sum_static("x") != std::unexpected(std::string("parsing"));
+    failures += sum_context("5") != 5;
+    failures += sum_context("x").has_value();
+    return failures == 0 ? 0 : 1;
+}
@@ -1,10 +1,28 @@
 set(MICA_UNITTEST_SOURCES
+    allocator_test.cpp
+    arena_test.cpp
+    checked_test.cpp
+    context_test.cpp
+    counters_test.cpp
+    error_test.cpp
     format_test.cpp
+    intern_test.cpp
+    io_test.cpp
+    latency_test.cpp
+    lift_test.cpp
     make_noexcept_capturing_lambda_test.cpp
     make_noexcept_free_function_test.cpp
     make_noexcept_member_function_test.cpp
     make_noexcept_noncapturing_lambda_test.cpp
+    parallel_test.cpp
+    parse_test.cpp
+    policy_test.cpp
+    result_test.cpp
+    sampling_test.cpp
+    task_test.cpp
+    transform_test.cpp
     try_test.cpp
+    try_vector_test.cpp
 )
 
 prepend_paths(
@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+// Fails every allocation
+struct exhausted_allocator
+{
+    void* allocate(std::size_t, std::size_t) noexcept
+    {
+        return nullptr;
+    }
+
+    void deallocate(void*, std::size_t, std::size_t) noexcept
+    {}
+};
+
+static_assert(mica::try_allocator<mica::heap_allocator>);
+static_assert(mica::try_allocator<mica::emergency_allocator<>>);
+static_assert(mica::try_allocator<exhausted_allocator>);
+static_assert(!mica::try_allocator<std::allocator<int>>);
+
+static_assert(sizeof(mica::try_ptr<int>) == sizeof(int*));
+
+struct alignas(64) over_aligned
+{
+    int value;
+};
+
+struct throwing
+{
+    throwing()
+    {
+        throw std::runtime_error("constructor failed");
+    }
+};
+
+} // unnamed namespace
+
+TEST_CASE("heap_allocator")
+{
+    mica::heap_allocator allocator;
+    void* pointer = allocator.allocate(100, alignof(std::max_align_t));
+    REQUIRE(pointer != nullptr);
+    allocator.deallocate(pointer, 100, alignof(std::max_align_t));
+
+    void* aligned = allocator.allocate(64, 256);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 256 == 0);
+    allocator.deallocate(aligned, 64, 256);
+}
+
+TEST_CASE("try_new")
+{
+    auto&& value = mica::try_new<std::string>(3, 'x');
+    REQUIRE(**value == "xxx");
+
+    auto&& aligned = mica::try_new<over_aligned>(over_aligned{7});
+    REQUIRE((*aligned)->value == 7);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned->get()) % 64 == 0);
+}
+
+TEST_CASE("try_new out of memory")
+{
+    auto&& value = mica::try_new<int, mica::error>(std::allocator_arg, exhausted_allocator(), 42);
+    REQUIRE(value.error() == mica::errc::bad_alloc);
+
+    auto&& text = mica::try_new<int>(std::allocator_arg, exhausted_allocator(), 42);
+    REQUIRE(text.error() == "bad allocation");
+}
+
+TEST_CASE("try_new constructor exception")
+{
+    REQUIRE_THROWS_AS(mica::try_new<throwing>(), std::runtime_error);
+}
+
+TEST_CASE("emergency_pool")
+{
+    mica::emergency_pool pool(4096);
+    std::vector<void*> blocks;
+    while (void* block = pool.allocate(64, 16)) {
+        REQUIRE(pool.owns(block));
+        blocks.push_back(block);
+    }
+    REQUIRE(!blocks.empty());
+    REQUIRE(blocks.size() < 4096 / 64);
+
+    // Freed blocks are reused
+    pool.deallocate(blocks.back(), 64, 16);
+    REQUIRE(pool.allocate(64, 16) == blocks.back());
+
+    int local = 0;
+    REQUIRE_FALSE(pool.owns(&local));
+}
+
+TEST_CASE("emergency_pool reuses its largest blocks")
+{
+    constexpr std::size_t largest = mica::allocation_policy::emergency_block_size;
+    mica::emergency_pool pool(16 * largest);
+    REQUIRE(pool.allocate(largest + 1, 16) == nullptr);
+    for (int i = 0; i < 100; ++i) {
+        void* block = pool.allocate(largest, 16);
+        REQUIRE(block != nullptr);
+        pool.deallocate(block, largest, 16);
+    }
+}
+
+TEST_CASE("emergency_pool without memory")
+{
+    mica::emergency_pool pool(0, std::nothrow);
+    REQUIRE(pool.allocate(16, 16) == nullptr);
+    REQUIRE(&mica::internal::global_emergency_pool == &mica::emergency_pool::global());
+}
+
+TEST_CASE("emergency_allocator")
+{
+    mica::emergency_pool pool(4096);
+    mica::emergency_allocator<exhausted_allocator> allocator(pool);
+    auto&& value = mica::try_new<std::string>(std::allocator_arg, allocator, "from the pool");
+    REQUIRE(**value == "from the pool");
+    REQUIRE(pool.owns(value->get()));
+
+    mica::emergency_allocator<> heap_first;
+    auto&& heap_value = mica::try_new<int>(std::allocator_arg, heap_first, 1);
+    REQUIRE_FALSE(mica::emergency_pool::global().owns(heap_value->get()));
+}
+
+} // namespace mica_test
@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <expected>
+#include <memory_resource>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace mica_test {
+
+namespace {
+
+constexpr const char* LONG_ERROR_MSG = "output is even and this message does not fit in SSO";
+
+class counting_resource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+int free_function_test(int a, int b)
+{
+    int output = a + b;
+    if (output % 2 == 0) {
+        throw std::runtime_error(LONG_ERROR_MSG);
+    }
+    return output;
+}
+
+std::expected<int, std::pmr::string> inner(int a, int b) noexcept
+{
+    int output = 0;
+    MICA_TRY(output, (mica::make_noexcept<free_function_test, std::pmr::string>(a, b)));
+    return output;
+}
+
+std::expected<int, std::pmr::string> outer(int a, int b) noexcept
+{
+    int output = 0;
+    MICA_TRY(output, inner(a, b));
+    return output;
+}
+
+} // unnamed namespace
+
+TEST_CASE("current_resource defaults to default resource")
+{
+    REQUIRE(mica::current_resource() == std::pmr::get_default_resource());
+}
+
+TEST_CASE("scoped_resource nests")
+{
+    counting_resource first;
+    counting_resource second;
+    {
+        mica::scoped_resource first_scope(&first);
+        REQUIRE(mica::current_resource() == &first);
+        {
+            mica::scoped_resource second_scope(&second);
+            REQUIRE(mica::current_resource() == &second);
+        }
+        REQUIRE(mica::current_resource() == &first);
+    }
+    REQUIRE(mica::current_resource() == std::pmr::get_default_resource());
+}
+
+TEST_CASE("scoped_arena installs arena")
+{
+    mica::scoped_arena arena(1024);
+    REQUIRE(mica::current_resource() == arena.resource());
+    auto&& exp = mica::make_noexcept<free_function_test, std::pmr::string>(2, 4);
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == LONG_ERROR_MSG);
+    REQUIRE(exp.error().get_allocator().resource() == arena.resource());
+}
+
+TEST_CASE("MICA_TRY propagates pmr string without reallocating")
+{
+    counting_resource resource;
+    mica::scoped_resource scope(&resource);
+    auto&& exp = outer(2, 4);
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == LONG_ERROR_MSG);
+    REQUIRE(exp.error().get_allocator().resource() == &resource);
+    REQUIRE(resource.allocations == 1);
+}
+
+TEST_CASE("format pmr")
+{
+    counting_resource resource;
+    auto&& exp = mica::format(&resource, "foobar: {}, {}, {}", 1, "hello", LONG_ERROR_MSG);
+    REQUIRE(exp.has_value());
+    REQUIRE(std::string_view(exp.value()) == std::string("foobar: 1, hello, ") + LONG_ERROR_MSG);
+    REQUIRE(exp.value().get_allocator().resource() == &resource);
+    REQUIRE(resource.allocations > 0);
+}
+
+TEST_CASE("format pmr scoped_arena")
+{
+    mica::scoped_arena arena;
+    auto&& exp = mica::format(mica::current_resource(), "foobar: {}", 1);
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == "foobar: 1");
+    REQUIRE(exp.value().get_allocator().resource() == arena.resource());
+}
+
+} // namespace mica_test
@@ -0,0 +1,153 @@
+#include <catch2/catch_test_macros.hpp>
+#include <any>
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <expected>
+#include <map>
+#include <mica/mica.hpp>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+using vector_at = int& (std::vector<int>::*)(std::size_t);
+using const_map_at = const int& (std::map<std::string, int>::*)(const std::string&) const;
+using optional_value = int& (std::optional<int>::*)() &;
+using variant_get_index = int& (*)(std::variant<int, double>&);
+using variant_get_type = const double& (*)(const std::variant<int, double>&);
+using any_cast_value = int (*)(const std::any&);
+
+static_assert(mica::internal::is_checked_accessor<static_cast<vector_at>(&std::vector<int>::at)>());
+static_assert(mica::internal::is_checked_accessor<static_cast<const_map_at>(&std::map<std::string, int>::at)>());
+static_assert(mica::internal::is_checked_accessor<static_cast<optional_value>(&std::optional<int>::value)>());
+static_assert(mica::internal::is_checked_accessor<static_cast<variant_get_index>(&std::get<0>)>());
+static_assert(mica::internal::is_checked_accessor<static_cast<variant_get_type>(&std::get<double>)>());
+static_assert(mica::internal::is_checked_accessor<static_cast<any_cast_value>(&std::any_cast<int>)>());
+
+int first(const std::variant<int, double>& variant)
+{
+    return std::get<int>(variant);
+}
+
+struct lookup
+{
+    int at(std::size_t index) const
+    {
+        return static_cast<int>(index);
+    }
+};
+
+static_assert(!mica::internal::is_checked_accessor<&first>());
+static_assert(!mica::internal::is_checked_accessor<&lookup::at>());
+static_assert(!mica::internal::is_checked_accessor<static_cast<std::size_t (std::vector<int>::*)() const noexcept>(&std::vector<int>::size)>());
+
+static_assert(mica::internal::throwing_accessor<static_cast<vector_at>(&std::vector<int>::at)>::value);
+static_assert(!mica::internal::throwing_accessor<&lookup::at>::value);
+
+static_assert(std::is_same_v<
+    decltype(mica::at(std::declval<const std::vector<int>&>(), 0)),
+    std::expected<std::reference_wrapper<const int>, std::string>
+>);
+
+} // unnamed namespace
+
+TEST_CASE("at index")
+{
+    std::vector<int> values{1, 2, 3};
+    REQUIRE(mica::at(values, 2)->get() == 3);
+    mica::at(values, 0)->get() = 10;
+    REQUIRE(values[0] == 10);
+    REQUIRE(mica::at(values, 3).error() == "out of range");
+    REQUIRE(mica::at<mica::error>(values, 100).error() == mica::errc::out_of_range);
+
+    const std::array<int, 2> array{4, 5};
+    REQUIRE(mica::at(array, 1)->get() == 5);
+
+    std::deque<int> deque{6};
+    REQUIRE(mica::at(deque, 0)->get() == 6);
+
+    std::string text("abc");
+    REQUIRE(mica::at(text, 1)->get() == 'b');
+
+    int c_array[] = {7, 8};
+    REQUIRE(mica::at(c_array, 1)->get() == 8);
+    REQUIRE_FALSE(mica::at(c_array, 2).has_value());
+}
+
+TEST_CASE("at key")
+{
+    std::map<std::string, int> map{{"one", 1}};
+    REQUIRE(mica::at(map, "one")->get() == 1);
+    mica::at(map, std::string("one"))->get() = 11;
+    REQUIRE(map["one"] == 11);
+    REQUIRE(mica::at<mica::error>(map, "two").error() == mica::errc::out_of_range);
+
+    const std::unordered_map<int, std::string> unordered{{1, "one"}};
+    REQUIRE(mica::at(unordered, 1)->get() == "one");
+    REQUIRE(mica::at(unordered, 2).error() == "out of range");
+}
+
+TEST_CASE("value")
+{
+    std::optional<int> engaged(5);
+    REQUIRE(mica::value(engaged)->get() == 5);
+    mica::value(engaged)->get() = 6;
+    REQUIRE(*engaged == 6);
+
+    const std::optional<std::string> empty;
+    REQUIRE(mica::value<mica::error>(empty).error() == mica::errc::bad_optional_access);
+    REQUIRE(mica::value(empty).error() == "bad optional access");
+}
+
+TEST_CASE("get")
+{
+    std::variant<int, std::string> variant(std::string("text"));
+    REQUIRE(mica::get<std::string>(variant)->get() == "text");
+    REQUIRE(mica::get<1>(variant)->get() == "text");
+    REQUIRE(mica::get<int, mica::error>(variant).error() == mica::errc::bad_variant_access);
+    REQUIRE(mica::get<0>(variant).error() == "bad variant access");
+
+    const std::variant<int, std::string> number(3);
+    REQUIRE(mica::get<int>(number)->get() == 3);
+    REQUIRE(mica::get<0>(number)->get() == 3);
+    REQUIRE_FALSE(mica::get<std::string>(number).has_value());
+}
+
+TEST_CASE("any_cast")
+{
+    std::any any(42);
+    REQUIRE(mica::any_cast<int>(any)->get() == 42);
+    mica::any_cast<int>(any)->get() = 43;
+    REQUIRE(std::any_cast<int>(any) == 43);
+    REQUIRE(mica::any_cast<long, mica::error>(any).error() == mica::errc::bad_any_cast);
+
+    const std::any empty;
+    REQUIRE(mica::any_cast<int>(empty).error() == "bad any cast");
+}
+
+TEST_CASE("exception codes of std accessors")
+{
+    auto&& optional = mica::make_noexcept<mica::error>([]() {
+        return std::optional<int>().value();
+    });
+    REQUIRE(optional.error() == mica::errc::bad_optional_access);
+
+    auto&& variant = mica::make_noexcept<mica::error>([]() {
+        return std::get<int>(std::variant<int, double>(1.0));
+    });
+    REQUIRE(variant.error() == mica::errc::bad_variant_access);
+
+    auto&& any = mica::make_noexcept<mica::error>([]() {
+        return std::any_cast<int>(std::any());
+    });
+    REQUIRE(any.error() == mica::errc::bad_any_cast);
+}
+
+} // namespace mica_test
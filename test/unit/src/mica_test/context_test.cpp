@@ -0,0 +1,183 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <expected>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+using context_error = mica::with_context<mica::error>;
+
+std::expected<int, mica::error> parse_digit(char c) noexcept
+{
+    if (c < '0' || c > '9') {
+        return std::unexpected(mica::errc::invalid_argument);
+    }
+    return c - '0';
+}
+
+std::expected<int, context_error> read_digit(char c) noexcept
+{
+    int output = 0;
+    MICA_TRY_CONTEXT(output, parse_digit(c), "reading digit");
+    return output;
+}
+
+std::expected<int, context_error> read_number(char tens, char ones) noexcept
+{
+    int first = 0;
+    MICA_TRY_CONTEXT(first, read_digit(tens), "reading tens");
+    int second = 0;
+    MICA_TRY_CONTEXT(second, read_digit(ones), "reading ones");
+    return first * 10 + second;
+}
+
+std::expected<void, context_error> validate_number(char tens, char ones) noexcept
+{
+    int output = 0;
+    MICA_TRY_CONTEXT(output, read_digit(tens), "reading tens");
+    MICA_TRY_CONTEXT(output, read_digit(ones), "reading ones");
+    return {};
+}
+
+std::expected<void, context_error> check_number(char tens, char ones) noexcept
+{
+    MICA_TRY_CONTEXT_VOID(validate_number(tens, ones), "checking number");
+    return {};
+}
+
+int throwing_parse(int value)
+{
+    if (value < 0) {
+        throw std::out_of_range("negative");
+    }
+    return value;
+}
+
+std::vector<std::string_view> messages(const mica::context_chain& chain)
+{
+    std::vector<std::string_view> output;
+    for (const mica::context_frame& frame : chain) {
+        output.emplace_back(frame.message);
+    }
+    return output;
+}
+
+} // unnamed namespace
+
+TEST_CASE("MICA_TRY_CONTEXT")
+{
+    auto&& exp = read_number('4', '2');
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 42);
+}
+
+TEST_CASE("MICA_TRY_CONTEXT error")
+{
+    auto&& exp = read_number('4', 'x');
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error().error() == mica::errc::invalid_argument);
+    auto chain = exp.error().context();
+    REQUIRE_FALSE(chain.empty());
+    REQUIRE_FALSE(chain.truncated());
+    REQUIRE(messages(chain) == std::vector<std::string_view>{"reading ones", "reading digit"});
+}
+
+TEST_CASE("MICA_TRY_CONTEXT records source locations")
+{
+    auto&& exp = read_digit('x');
+    REQUIRE_FALSE(exp.has_value());
+    auto chain = exp.error().context();
+    auto it = chain.begin();
+    REQUIRE(it != chain.end());
+    REQUIRE(std::string_view(it->location.file_name()).ends_with("context_test.cpp"));
+    REQUIRE(std::string_view(it->location.function_name()).find("read_digit") != std::string_view::npos);
+    REQUIRE(it->location.line() > 0);
+}
+
+TEST_CASE("MICA_TRY_CONTEXT_VOID error")
+{
+    auto&& exp = check_number('x', '1');
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(
+        messages(exp.error().context())
+            == std::vector<std::string_view>{"checking number", "reading tens", "reading digit"}
+    );
+}
+
+TEST_CASE("with_context without frames")
+{
+    context_error error(mica::errc::bad_alloc);
+    REQUIRE(error.error() == mica::errc::bad_alloc);
+    REQUIRE(error.context().empty());
+    REQUIRE_FALSE(error.context().truncated());
+    REQUIRE(mica::to_string(error.context()).empty());
+}
+
+TEST_CASE("with_context to_string")
+{
+    auto&& exp = read_number('x', '1');
+    REQUIRE_FALSE(exp.has_value());
+    auto text = mica::to_string(exp.error().context());
+    REQUIRE(text.starts_with("reading tens ("));
+    REQUIRE(text.find("\nreading digit (") != std::string::npos);
+    REQUIRE(text.find("context_test.cpp:") != std::string::npos);
+}
+
+TEST_CASE("with_context keeps the oldest frames")
+{
+    context_error error(mica::errc::unknown);
+    error.add_context("oldest");
+    for (std::size_t i = 1; i < context_error::capacity; ++i) {
+        error.add_context("middle");
+    }
+    REQUIRE_FALSE(error.context().truncated());
+    error.add_context("newest");
+    auto chain = error.context();
+    REQUIRE(chain.size() == context_error::capacity);
+    REQUIRE(chain.truncated());
+    REQUIRE(messages(chain).back() == "oldest");
+    REQUIRE(messages(chain).front() == "middle");
+    REQUIRE(mica::to_string(chain).starts_with("...\nmiddle ("));
+}
+
+TEST_CASE("with_context frames are independent of other errors")
+{
+    auto&& exp = read_number('4', 'x');
+    REQUIRE_FALSE(exp.has_value());
+    for (std::size_t i = 0; i < 1000; ++i) {
+        static_cast<void>(mica::add_context(mica::error(), "unrelated"));
+    }
+    REQUIRE(messages(exp.error().context()) == std::vector<std::string_view>{"reading ones", "reading digit"});
+}
+
+TEST_CASE("with_context frames are readable on other threads")
+{
+    auto&& exp = read_digit('x');
+    REQUIRE_FALSE(exp.has_value());
+    std::vector<std::string_view> read;
+    bool truncated = true;
+    std::thread([&]() {
+        auto chain = exp.error().context();
+        read = messages(chain);
+        truncated = chain.truncated();
+    }).join();
+    REQUIRE(read == std::vector<std::string_view>{"reading digit"});
+    REQUIRE_FALSE(truncated);
+}
+
+TEST_CASE("make_noexcept with_context")
+{
+    auto&& exp = mica::make_noexcept<throwing_parse, context_error>(-1);
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error().error() == mica::errc::out_of_range);
+    REQUIRE(exp.error().context().empty());
+}
+
+} // namespace mica_test
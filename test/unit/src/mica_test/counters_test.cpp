@@ -0,0 +1,204 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <expected>
+#include <mica/mica.hpp>
+#include <mica_test/site_helpers.hpp>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+std::expected<int, std::string> check(int value) noexcept
+{
+    if (value < 0) {
+        return std::unexpected(std::string("negative"));
+    }
+    return value;
+}
+
+using parse_site = MICA_CALL_SITE;
+
+#if MICA_COUNTERS
+using thread_site = MICA_CALL_SITE;
+
+using report_site = MICA_CALL_SITE;
+
+using transform_site = MICA_CALL_SITE;
+
+using parallel_site = MICA_CALL_SITE;
+#endif
+
+std::uint32_t try_line = 0;
+
+std::expected<int, std::string> try_twice(int value) noexcept
+{
+    int output = 0;
+    try_line = __LINE__ + 1;
+    MICA_TRY(output, check(value));
+    return output * 2;
+}
+
+#if MICA_COUNTERS
+std::uint64_t exception_count(const mica::call_site_counters& site, const std::string& type)
+{
+    for (const auto& exception : site.exceptions) {
+        if (exception.type == type) {
+            return exception.count;
+        }
+    }
+    return 0;
+}
+#endif
+
+} // unnamed namespace
+
+TEST_CASE("call site")
+{
+    using site = MICA_CALL_SITE;
+    using other = MICA_CALL_SITE;
+    STATIC_REQUIRE(site::line + 1 == other::line);
+    STATIC_REQUIRE(site::file == other::file);
+    STATIC_REQUIRE(site::id != other::id);
+    STATIC_REQUIRE(site::file.ends_with("counters_test.cpp"));
+}
+
+#if MICA_COUNTERS
+TEST_CASE("counted policy")
+{
+    using policy = mica::counted<std::string, parse_site>;
+    STATIC_REQUIRE(std::is_same_v<mica::policy_error_t<policy>, std::string>);
+
+    REQUIRE(observed_parse<policy>(1).value() == 1);
+    REQUIRE(observed_parse<policy>(2).value() == 2);
+    REQUIRE(observed_parse<policy>(0).error() == "zero");
+    REQUIRE(observed_parse<policy>(-1).error() == NEGATIVE_MSG);
+    REQUIRE(observed_parse<policy>(-2).error() == NEGATIVE_MSG);
+
+    auto&& snapshot = mica::snapshot_counters();
+    auto* site = find_site(snapshot, parse_site::id);
+    REQUIRE(site != nullptr);
+    REQUIRE(site->file == parse_site::file);
+    REQUIRE(site->line == parse_site::line);
+    REQUIRE(site->calls == 5);
+    REQUIRE(site->failures == 3);
+    REQUIRE(exception_count(*site, "std::out_of_range") == 1);
+    REQUIRE(exception_count(*site, "std::invalid_argument") == 2);
+}
+
+TEST_CASE("counted MICA_TRY")
+{
+    REQUIRE(try_twice(1).value() == 2);
+    REQUIRE(try_twice(-1).error() == "negative");
+
+    auto&& snapshot = mica::snapshot_counters();
+    const mica::call_site_counters* site = nullptr;
+    for (const auto& candidate : snapshot.sites) {
+        if (candidate.line == try_line && candidate.file == parse_site::file) {
+            site = &candidate;
+        }
+    }
+    REQUIRE(site != nullptr);
+    REQUIRE(site->calls == 2);
+    REQUIRE(site->failures == 1);
+    REQUIRE(site->exceptions.empty());
+}
+
+TEST_CASE("counters are merged across threads")
+{
+    using policy = mica::counted<std::string, thread_site>;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([]() {
+            for (int j = 0; j < 100; ++j) {
+                static_cast<void>(observed_parse<policy>(j % 10 == 0 ? -1 : j));
+            }
+        });
+    }
+    // Live threads are included as well as exited ones
+    for (int j = 0; j < 100; ++j) {
+        static_cast<void>(observed_parse<policy>(-1));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto&& snapshot = mica::snapshot_counters();
+    auto* site = find_site(snapshot, thread_site::id);
+    REQUIRE(site != nullptr);
+    REQUIRE(site->calls == 500);
+    REQUIRE(site->failures == 140);
+    REQUIRE(exception_count(*site, "std::invalid_argument") == 140);
+}
+
+TEST_CASE("counted transforms count every element")
+{
+    const std::vector<int> input{1, -1, 2, 0, 3};
+    mica::columnar_result<int> output;
+    using transform_policy = mica::counted<std::string, transform_site>;
+    REQUIRE(mica::transform_noexcept<parse_positive, transform_policy>(input, output).has_value());
+    REQUIRE(output.failure_count() == 2);
+
+    mica::columnar_result<int> parallel_output;
+    mica::thread_pool pool(2);
+    using parallel_policy = mica::counted<std::string, parallel_site>;
+    REQUIRE(mica::parallel_transform_noexcept<parse_positive, parallel_policy>(
+        input,
+        parallel_output,
+        pool,
+        mica::failure_mode::collect
+    ).has_value());
+
+    auto&& snapshot = mica::snapshot_counters();
+    for (std::uint64_t id : {transform_site::id, parallel_site::id}) {
+        auto* site = find_site(snapshot, id);
+        REQUIRE(site != nullptr);
+        REQUIRE(site->calls == 5);
+        REQUIRE(site->failures == 2);
+    }
+}
+
+TEST_CASE("counters to_string and to_json")
+{
+    using policy = mica::counted<std::string, report_site>;
+    REQUIRE(observed_parse<policy>(-1).error() == NEGATIVE_MSG);
+    auto&& snapshot = mica::snapshot_counters();
+
+    auto&& text = mica::to_string(snapshot);
+    REQUIRE(text.find("counters_test.cpp:" + std::to_string(report_site::line) + " calls 1 ") != std::string::npos);
+    REQUIRE(text.find("\n    std::invalid_argument ") != std::string::npos);
+
+    auto&& json = mica::to_json(snapshot);
+    REQUIRE(json.starts_with("{\"sites\":[{\"id\":\""));
+    REQUIRE(json.find("\"line\":" + std::to_string(report_site::line) + ",") != std::string::npos);
+    REQUIRE(json.find("{\"type\":\"std::invalid_argument\",\"count\":") != std::string::npos);
+    REQUIRE(json.ends_with("]}]}"));
+}
+#else
+TEST_CASE("counted policy without MICA_COUNTERS")
+{
+    using policy = mica::counted<std::string, parse_site>;
+    STATIC_REQUIRE(std::is_same_v<mica::policy_error_t<policy>, std::string>);
+    STATIC_REQUIRE(std::is_same_v<
+        typename mica::policy_traits<policy>::observer,
+        mica::internal::policy_observer_t<std::string>
+    >);
+
+    REQUIRE(observed_parse<policy>(1).value() == 1);
+    REQUIRE(observed_parse<policy>(0).error() == "zero");
+    REQUIRE(observed_parse<policy>(-1).error() == NEGATIVE_MSG);
+    REQUIRE(try_twice(1).value() == 2);
+    REQUIRE(try_twice(-1).error() == "negative");
+    REQUIRE(try_line != 0);
+
+    auto&& snapshot = mica::snapshot_counters();
+    REQUIRE(find_site(snapshot, parse_site::id) == nullptr);
+    REQUIRE(snapshot.sites.empty());
+    REQUIRE(mica::to_json(snapshot) == "{\"sites\":[]}");
+}
+#endif
+
+} // namespace mica_test
@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+#include <expected>
+#include <mica/mica.hpp>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+
+namespace mica_test {
+
+namespace {
+
+static_assert(sizeof(std::expected<int, mica::error>) <= 16);
+static_assert(sizeof(std::expected<void, mica::error>) <= 16);
+
+int free_function_test(int a, int b)
+{
+    int output = a + b;
+    if (output % 2 == 0) {
+        throw std::invalid_argument("output is even");
+    }
+    return output;
+}
+
+void free_function_test_void_return(int a, int b)
+{
+    free_function_test(a, b);
+}
+
+int throws_bad_alloc()
+{
+    throw std::bad_alloc();
+}
+
+int throws_int()
+{
+    throw 42;
+}
+
+} // unnamed namespace
+
+TEST_CASE("error from errc")
+{
+    constexpr mica::error err(mica::errc::out_of_range);
+    STATIC_REQUIRE(err.category() == mica::error_category::mica);
+    STATIC_REQUIRE(err == mica::errc::out_of_range);
+    REQUIRE(std::string_view(err.message()) == "out of range");
+    REQUIRE(mica::to_string(mica::errc::bad_alloc) == "bad allocation");
+}
+
+TEST_CASE("error from static message")
+{
+    constexpr mica::error err("foobar error");
+    STATIC_REQUIRE(err.category() == mica::error_category::user);
+    REQUIRE(std::string_view(err.message()) == "foobar error");
+    REQUIRE(err != mica::errc::unknown);
+}
+
+TEST_CASE("make_noexcept mica::error success")
+{
+    auto&& exp = mica::make_noexcept<free_function_test, mica::error>(1, 2);
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 3);
+}
+
+TEST_CASE("make_noexcept mica::error maps exception type")
+{
+    {
+        auto&& exp = mica::make_noexcept<free_function_test, mica::error>(2, 4);
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == mica::errc::invalid_argument);
+    }
+    {
+        auto&& exp = mica::make_noexcept<throws_bad_alloc, mica::error>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == mica::errc::bad_alloc);
+    }
+    {
+        auto&& exp = mica::make_noexcept<throws_int, mica::error>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == mica::errc::unknown);
+    }
+    {
+        auto&& lambda = [](int a) -> int {
+            return free_function_test(a, 2);
+        };
+        auto&& exp = mica::make_noexcept<mica::error>(lambda, 4);
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == mica::errc::invalid_argument);
+    }
+}
+
+TEST_CASE("MICA_TRY mica::error")
+{
+    auto&& exp = []() noexcept -> std::expected<int, mica::error> {
+        int output = 0;
+        MICA_TRY(output, (mica::make_noexcept<free_function_test, mica::error>(2, 4)));
+        return output;
+    }();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == mica::errc::invalid_argument);
+}
+
+TEST_CASE("MICA_TRY_VOID mica::error")
+{
+    auto&& exp = []() noexcept -> std::expected<void, mica::error> {
+        MICA_TRY_VOID((mica::make_noexcept<free_function_test_void_return, mica::error>(2, 4)));
+        return std::expected<void, mica::error>();
+    }();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == mica::errc::invalid_argument);
+}
+
+TEST_CASE("MICA_TRY_STATIC mica::error")
+{
+    auto&& exp = []() noexcept -> std::expected<int, mica::error> {
+        int output = 0;
+        MICA_TRY_STATIC(output, (mica::make_noexcept<free_function_test, mica::error>(2, 4)), "foobar error");
+        return output;
+    }();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error().category() == mica::error_category::user);
+    REQUIRE(std::string_view(exp.error().message()) == "foobar error");
+}
+
+TEST_CASE("format mica::error")
+{
+    auto&& exp = mica::format<mica::error>("foobar: {}, {}", 1, "hello");
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == "foobar: 1, hello");
+}
+
+} // namespace mica_test
@@ -1,9 +1,69 @@
+#include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
 #include <expected>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
 #include <mica/mica.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace mica_test {
 
+namespace {
+
+static_assert(mica::format_string<int, std::string_view>("id={} msg={}").plan().fast);
+static_assert(mica::format_string<int>("{{{0}}} {0:}").plan().fast);
+static_assert(mica::format_string<double, const char*>("{} {}").plan().fast);
+static_assert(!mica::format_string<int>("{:>8}").plan().fast);
+static_assert(!mica::format_string<bool>("{}").plan().fast);
+static_assert(!mica::format_string<char>("{}").plan().fast);
+static_assert(!mica::format_string<long double>("{}").plan().fast);
+static_assert(!mica::format_string<int>(
+    "{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}"
+).plan().fast);
+
+// mica::format must produce exactly what std::format does
+template<typename... Args>
+void require_same_as_std_format(std::format_string<Args&...> std_fmt, mica::format_string<Args&...> fmt, Args... args)
+{
+    auto&& exp = mica::format(fmt, args...);
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == std::format(std_fmt, args...));
+    std::string output("previous contents that are longer than the output");
+    auto&& into = mica::format_into(output, fmt, args...);
+    REQUIRE(into.has_value());
+    REQUIRE(output == exp.value());
+
+    std::pmr::monotonic_buffer_resource resource;
+    auto&& pmr = mica::format(&resource, fmt, args...);
+    REQUIRE(pmr.has_value());
+    REQUIRE(std::string_view(pmr.value()) == exp.value());
+
+    std::string appended("prefix ");
+    auto&& to = mica::format_to(std::back_inserter(appended), fmt, args...);
+    REQUIRE(to.value() == exp.value().size());
+    REQUIRE(appended == "prefix " + exp.value());
+
+    std::vector<char> buffer(exp.value().size());
+    auto&& to_n = mica::format_to_n(buffer, fmt, args...);
+    REQUIRE(to_n.value() == exp.value().size());
+    REQUIRE(std::string_view(buffer.data(), buffer.size()) == exp.value());
+    if (!buffer.empty()) {
+        // Truncated output matches std::format_to_n as well
+        std::vector<char> expected(buffer.size() - 1);
+        std::format_to_n(expected.data(), std::ssize(expected), std_fmt, args...);
+        std::vector<char> truncated(buffer.size() - 1);
+        REQUIRE(mica::format_to_n<mica::error>(truncated, fmt, args...).error() == mica::errc::truncated);
+        REQUIRE(truncated == expected);
+    }
+}
+
+} // unnamed namespace
+
 TEST_CASE("format 1")
 {
     auto&& exp = mica::format("foobar: {}, {}", 1, "hello");
@@ -11,4 +71,124 @@ TEST_CASE("format 1")
     REQUIRE(exp.value() == "foobar: 1, hello");
 }
 
+TEST_CASE("format fast path")
+{
+    require_same_as_std_format<int, int, std::string_view>(
+        "id={} status={} msg={}",
+        "id={} status={} msg={}",
+        42, -200, "done"
+    );
+    require_same_as_std_format<std::int8_t, std::uint8_t, short, long long, unsigned long long>(
+        "{} {} {} {} {}",
+        "{} {} {} {} {}",
+        std::numeric_limits<std::int8_t>::min(),
+        std::numeric_limits<std::uint8_t>::max(),
+        std::numeric_limits<short>::min(),
+        std::numeric_limits<long long>::min(),
+        std::numeric_limits<unsigned long long>::max()
+    );
+    require_same_as_std_format<double, float, double, double>(
+        "{} {} {} {}",
+        "{} {} {} {}",
+        0.1, 1.5f, -std::numeric_limits<double>::max(), 1e-300
+    );
+    require_same_as_std_format<std::string, const char*>(
+        "{{{1}}} {0:} {1}",
+        "{{{1}}} {0:} {1}",
+        std::string(100, 'x'), "text"
+    );
+    require_same_as_std_format<>("no fields }}", "no fields }}");
+}
+
+TEST_CASE("format releases the bound of short outputs")
+{
+    auto&& exp = mica::format("{}", std::int64_t(7));
+    REQUIRE(exp.value() == "7");
+    REQUIRE(exp.value().capacity() == std::string().capacity());
+
+    std::pmr::monotonic_buffer_resource resource;
+    auto&& pmr_exp = mica::format(&resource, "{} {}", 7, 8);
+    REQUIRE(std::string_view(pmr_exp.value()) == "7 8");
+    REQUIRE(pmr_exp.value().capacity() == std::pmr::string(&resource).capacity());
+
+    // Longer outputs keep the bound as their capacity
+    const std::string long_text(300, 'x');
+    auto&& in_place = mica::format("{} {}", long_text, 1);
+    REQUIRE(in_place.value() == long_text + " 1");
+    REQUIRE(in_place.value().capacity() >= long_text.size() + 1 + 11);
+}
+
+TEST_CASE("format fallback")
+{
+    require_same_as_std_format<int, bool>("{:>8} {}", "{:>8} {}", 42, true);
+    require_same_as_std_format<char, long double>("{} {}", "{} {}", 'c', 1.5L);
+    require_same_as_std_format<int>(
+        "{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}",
+        "{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}{0}",
+        7
+    );
+}
+
+TEST_CASE("format_to")
+{
+    std::string output;
+    auto&& exp = mica::format_to(std::back_inserter(output), "foobar: {}, {}", 1, "hello");
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 16);
+    REQUIRE(output == "foobar: 1, hello");
+}
+
+TEST_CASE("format_to_n")
+{
+    std::array<char, 32> buffer{};
+    auto&& exp = mica::format_to_n(buffer, "foobar: {}, {}", 1, "hello");
+    REQUIRE(exp.has_value());
+    REQUIRE(std::string_view(buffer.data(), exp.value()) == "foobar: 1, hello");
+}
+
+TEST_CASE("format_to_n truncated")
+{
+    {
+        std::array<char, 8> buffer{};
+        auto&& exp = mica::format_to_n(buffer, "foobar: {}, {}", 1, "hello");
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == mica::to_string(mica::errc::truncated));
+    }
+    {
+        std::array<char, 8> buffer{};
+        auto&& exp = mica::format_to_n<mica::error>(buffer, "foobar: {}, {}", 1, "hello");
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == mica::errc::truncated);
+    }
+}
+
+TEST_CASE("format_into")
+{
+    std::string output("previous contents");
+    auto&& exp = mica::format_into(output, "foobar: {}, {}", 1, "hello");
+    REQUIRE(exp.has_value());
+    REQUIRE(output == "foobar: 1, hello");
+}
+
+TEST_CASE("format_into grows")
+{
+    std::string output;
+    auto&& exp = mica::format_into(output, "foobar: {}, {}", 1, std::string(64, 'a'));
+    REQUIRE(exp.has_value());
+    REQUIRE(output == "foobar: 1, " + std::string(64, 'a'));
+}
+
+TEST_CASE("format_into reuses capacity")
+{
+    std::string output;
+    output.reserve(128);
+    const char* data = output.data();
+    for (int i = 0; i < 8; ++i) {
+        auto&& exp = mica::format_into(output, "foobar: {}, {}", i, "hello");
+        REQUIRE(exp.has_value());
+        REQUIRE(output == "foobar: " + std::to_string(i) + ", hello");
+        REQUIRE(output.data() == data);
+    }
+}
+
 } // namespace mica_test
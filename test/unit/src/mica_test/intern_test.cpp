@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <expected>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+static_assert(sizeof(mica::interned) == 8);
+static_assert(sizeof(std::expected<int, mica::interned>) <= 16);
+
+struct small_intern_policy
+{
+    static constexpr std::size_t max_entries = 4;
+    static constexpr std::size_t max_length = 8;
+};
+
+int free_function_test(int a, int b)
+{
+    int output = a + b;
+    if (output % 2 == 0) {
+        throw std::runtime_error("output is even");
+    }
+    return output;
+}
+
+int throws_int()
+{
+    throw 42;
+}
+
+} // unnamed namespace
+
+TEST_CASE("intern same message")
+{
+    auto&& first = mica::intern("foobar error");
+    auto&& second = mica::intern(std::string("foobar error"));
+    REQUIRE(first == second);
+    REQUIRE(first.view() == "foobar error");
+    REQUIRE_FALSE(first.dropped());
+}
+
+TEST_CASE("intern different messages")
+{
+    auto&& first = mica::intern("foobar error");
+    auto&& second = mica::intern("hello error");
+    REQUIRE(first != second);
+    REQUIRE(second.view() == "hello error");
+}
+
+TEST_CASE("intern policy bounds")
+{
+    mica::intern_table<small_intern_policy> table;
+    REQUIRE(table.intern("too long message").dropped());
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE_FALSE(table.intern(std::to_string(i)).dropped());
+    }
+    REQUIRE(table.size() == 4);
+    REQUIRE(table.intern("4").dropped());
+    REQUIRE_FALSE(table.intern("0").dropped());
+    REQUIRE(table.size() == 4);
+}
+
+TEST_CASE("intern concurrently")
+{
+    mica::intern_table<> table;
+    std::vector<std::vector<mica::interned>> results(4);
+    std::vector<std::thread> threads;
+    for (auto& result : results) {
+        threads.emplace_back([&table, &result]() {
+            for (int i = 0; i < 64; ++i) {
+                result.push_back(table.intern(std::to_string(i)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(table.size() == 64);
+    for (auto& result : results) {
+        REQUIRE(result == results.front());
+    }
+}
+
+TEST_CASE("make_noexcept interned")
+{
+    auto&& first = mica::make_noexcept<free_function_test, mica::interned>(2, 4);
+    auto&& second = mica::make_noexcept<free_function_test, mica::interned>(4, 6);
+    REQUIRE_FALSE(first.has_value());
+    REQUIRE_FALSE(second.has_value());
+    REQUIRE(first.error() == second.error());
+    REQUIRE(first.error().view() == "output is even");
+}
+
+TEST_CASE("make_noexcept interned unknown")
+{
+    auto&& exp = mica::make_noexcept<throws_int, mica::interned>();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error().view() == "unexpected error");
+}
+
+TEST_CASE("MICA_TRY interned")
+{
+    auto&& exp = []() noexcept -> std::expected<int, mica::interned> {
+        int output = 0;
+        MICA_TRY(output, (mica::make_noexcept<free_function_test, mica::interned>(2, 4)));
+        return output;
+    }();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error().view() == "output is even");
+}
+
+} // namespace mica_test
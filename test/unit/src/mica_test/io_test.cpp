@@ -0,0 +1,216 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <mica/mica.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+const std::string CONTENT("first line\nsecond line\n");
+
+// File in the temporary directory, removed on destruction
+class temporary_file {
+public:
+    temporary_file(std::string_view name, std::string_view content)
+        : path_(std::filesystem::temp_directory_path() / name)
+    {
+        std::ofstream output(path_, std::ios::binary);
+        output.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    ~temporary_file()
+    {
+        std::filesystem::remove(path_);
+    }
+
+    const std::filesystem::path& path() const noexcept
+    {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+std::string_view as_text(std::span<const std::byte> bytes)
+{
+    return std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+std::expected<std::size_t, std::string> count_lines(const std::filesystem::path& path) noexcept
+{
+    MICA_TRY_DECL(auto&& mapping, mica::io::map_file<std::string>(path));
+    std::size_t lines = 0;
+    for (char c : mapping.text()) {
+        lines += c == '\n';
+    }
+    return lines;
+}
+
+} // unnamed namespace
+
+TEST_CASE("map_file")
+{
+    temporary_file file("mica_io_map_file", CONTENT);
+    auto&& mapping = mica::io::map_file(file.path());
+    REQUIRE(mapping.has_value());
+    REQUIRE(mapping->size() == CONTENT.size());
+    REQUIRE(mapping->text() == CONTENT);
+    REQUIRE(as_text(mapping->bytes()) == CONTENT);
+
+    mica::io::mapped_file moved(std::move(*mapping));
+    REQUIRE(moved.text() == CONTENT);
+    REQUIRE(mapping->empty());
+}
+
+TEST_CASE("map_file access patterns")
+{
+    temporary_file file("mica_io_access_patterns", CONTENT);
+    for (auto pattern : {
+        mica::io::access_pattern::normal,
+        mica::io::access_pattern::sequential,
+        mica::io::access_pattern::random,
+        mica::io::access_pattern::will_need,
+    }) {
+        REQUIRE(mica::io::map_file(file.path(), pattern)->text() == CONTENT);
+    }
+}
+
+TEST_CASE("map_file empty file")
+{
+    temporary_file file("mica_io_empty", "");
+    auto&& mapping = mica::io::map_file(file.path());
+    REQUIRE(mapping.has_value());
+    REQUIRE(mapping->empty());
+    REQUIRE(mapping->bytes().empty());
+}
+
+TEST_CASE("map_file errors")
+{
+    auto&& missing = mica::io::map_file("/nonexistent/mica_io");
+    REQUIRE(missing.error().category() == mica::error_category::system);
+    REQUIRE(missing.error().code() == ENOENT);
+
+    auto&& missing_text = mica::io::map_file<std::string>("/nonexistent/mica_io");
+    REQUIRE(missing_text.error() == "no such file or directory: /nonexistent/mica_io");
+
+    auto&& directory = mica::io::map_file<mica::error>(std::filesystem::temp_directory_path());
+    REQUIRE(directory.error().category() == mica::error_category::system);
+    REQUIRE(directory.error().code() == EISDIR);
+    REQUIRE(std::string_view(directory.error().message()) == "is a directory");
+}
+
+TEST_CASE("map_file with MICA_TRY_DECL")
+{
+    temporary_file file("mica_io_try", CONTENT);
+    REQUIRE(count_lines(file.path()).value() == 2);
+    REQUIRE(count_lines("/nonexistent/mica_io").error() == "no such file or directory: /nonexistent/mica_io");
+}
+
+TEST_CASE("pread")
+{
+    temporary_file file("mica_io_pread", CONTENT);
+    auto&& input = mica::io::open(file.path());
+    REQUIRE(input->is_open());
+
+    std::vector<std::byte> buffer(6);
+    REQUIRE(mica::io::pread(*input, buffer, 11).value() == 6);
+    REQUIRE(as_text(buffer) == "second");
+
+    // Stops at the end of the file
+    std::vector<std::byte> tail(64);
+    auto&& count = mica::io::pread(*input, tail, 18);
+    REQUIRE(count.value() == 5);
+    REQUIRE(as_text(std::span(tail).first(*count)) == "line\n");
+    REQUIRE(mica::io::pread(*input, tail, 1000).value() == 0);
+}
+
+TEST_CASE("pread errors")
+{
+    mica::io::file closed;
+    REQUIRE_FALSE(closed.is_open());
+    std::vector<std::byte> buffer(4);
+    REQUIRE(mica::io::pread<mica::error>(closed, buffer, 0).error().code() == EBADF);
+
+    auto&& missing = mica::io::open<mica::with_context<std::string>>("/nonexistent/mica_io");
+    REQUIRE(missing.error().error() == "no such file or directory");
+}
+
+TEST_CASE("open moves the descriptor")
+{
+    temporary_file file("mica_io_open", CONTENT);
+    auto&& input = mica::io::open(file.path());
+    const int descriptor = input->descriptor();
+    mica::io::file moved(std::move(*input));
+    REQUIRE(moved.descriptor() == descriptor);
+    REQUIRE_FALSE(input->is_open());
+}
+
+TEST_CASE("read_all")
+{
+    temporary_file file("mica_io_read_all", CONTENT);
+    auto&& bytes = mica::io::read_all(file.path());
+    REQUIRE(as_text(bytes.value()) == CONTENT);
+
+    temporary_file empty("mica_io_read_all_empty", "");
+    REQUIRE(mica::io::read_all(empty.path()).value().empty());
+
+    const std::string large(100000, 'x');
+    temporary_file large_file("mica_io_read_all_large", large);
+    REQUIRE(as_text(mica::io::read_all(large_file.path()).value()) == large);
+}
+
+TEST_CASE("read_all unknown size")
+{
+    // Reports a size of 0 but has content
+    if (std::filesystem::exists("/proc/self/status")) {
+        auto&& bytes = mica::io::read_all("/proc/self/status");
+        REQUIRE(bytes.has_value());
+        REQUIRE(as_text(*bytes).starts_with("Name:"));
+    }
+}
+
+TEST_CASE("read_all errors")
+{
+    auto&& missing = mica::io::read_all<mica::interned>("/nonexistent/mica_io");
+    REQUIRE(missing.error().view() == "no such file or directory");
+
+    const std::filesystem::path temporary = std::filesystem::temp_directory_path();
+    auto&& directory = mica::io::read_all<std::string>(temporary);
+    REQUIRE(directory.error() == "is a directory: " + temporary.string());
+}
+
+TEST_CASE("io functions are noexcept without allocating errors")
+{
+    const std::filesystem::path path;
+    std::vector<std::byte> buffer;
+    mica::io::file input;
+    STATIC_REQUIRE(noexcept(mica::io::open(path)));
+    STATIC_REQUIRE(noexcept(mica::io::map_file(path)));
+    STATIC_REQUIRE(noexcept(mica::io::pread(input, buffer, 0)));
+    STATIC_REQUIRE(noexcept(mica::io::read_all(path)));
+    STATIC_REQUIRE_FALSE(noexcept(mica::io::open<std::string>(path)));
+    STATIC_REQUIRE_FALSE(noexcept(mica::io::read_all<std::string>(path)));
+}
+
+TEST_CASE("errno_error")
+{
+    REQUIRE(mica::internal::errno_error<std::string>(EACCES) == "permission denied");
+    REQUIRE(mica::internal::errno_error<std::string>(12345).starts_with("Unknown error"));
+
+    const mica::error uncommon = mica::internal::errno_error<mica::error>(EXDEV);
+    REQUIRE(uncommon.code() == EXDEV);
+    REQUIRE(std::string_view(uncommon.message()) == "system error");
+
+    REQUIRE(mica::internal::errno_error<mica::with_context<mica::error>>(ENOENT).error().code() == ENOENT);
+}
+
+} // namespace mica_test
@@ -0,0 +1,189 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <mica/mica.hpp>
+#include <mica_test/site_helpers.hpp>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+using parse_site = MICA_CALL_SITE;
+
+#if MICA_LATENCY
+using both_site = MICA_CALL_SITE;
+
+using thread_site = MICA_CALL_SITE;
+
+using report_site = MICA_CALL_SITE;
+
+using transform_site = MICA_CALL_SITE;
+#endif
+
+} // unnamed namespace
+
+TEST_CASE("latency buckets")
+{
+    using mica::internal::latency_bucket;
+    using mica::internal::latency_bucket_limit;
+    STATIC_REQUIRE(latency_bucket(0) == 0);
+    STATIC_REQUIRE(latency_bucket(15) == 15);
+    STATIC_REQUIRE(latency_bucket(16) == 16);
+    STATIC_REQUIRE(latency_bucket(17) == 16);
+    STATIC_REQUIRE(latency_bucket_limit(16) == 17);
+    STATIC_REQUIRE(latency_bucket(~std::uint64_t(0)) == mica::latency_histogram::bucket_count - 1);
+
+    std::size_t previous = 0;
+    for (std::uint64_t value = 1; value < (std::uint64_t(1) << 30); value += value / 7 + 1) {
+        const std::size_t bucket = latency_bucket(value);
+        REQUIRE(bucket >= previous);
+        REQUIRE(latency_bucket_limit(bucket) >= value);
+        REQUIRE(latency_bucket_limit(bucket) - value <= value / 8);
+        REQUIRE(latency_bucket(latency_bucket_limit(bucket)) == bucket);
+        previous = bucket;
+    }
+}
+
+TEST_CASE("latency_histogram")
+{
+    mica::latency_histogram histogram;
+    REQUIRE(histogram.count() == 0);
+    REQUIRE(histogram.percentile(0.5).count() == 0);
+
+    for (int i = 1; i <= 1000; ++i) {
+        histogram.record(std::chrono::nanoseconds(i));
+    }
+    REQUIRE(histogram.count() == 1000);
+    REQUIRE(histogram.percentile(0.5).count() >= 500);
+    REQUIRE(histogram.percentile(0.5).count() <= 500 + 500 / 8);
+    REQUIRE(histogram.percentile(0.99).count() >= 990);
+    REQUIRE(histogram.percentile(0.99).count() <= 990 + 990 / 8);
+    REQUIRE(histogram.percentile(1.0) == histogram.max());
+    REQUIRE(histogram.max().count() >= 1000);
+
+    mica::latency_histogram other;
+    other.record(std::chrono::milliseconds(1), 10);
+    histogram.merge(other);
+    REQUIRE(histogram.count() == 1010);
+    REQUIRE(histogram.percentile(0.999).count() >= 1000000);
+}
+
+#if MICA_LATENCY
+TEST_CASE("timed policy")
+{
+    using policy = mica::timed<std::string, parse_site>;
+    REQUIRE(observed_parse<policy>(1).value() == 1);
+    REQUIRE(observed_parse<policy>(2).value() == 2);
+    REQUIRE(observed_parse<policy>(3).value() == 3);
+    REQUIRE(observed_parse<policy>(-1).error() == NEGATIVE_MSG);
+    REQUIRE(observed_parse<policy>(-2).error() == NEGATIVE_MSG);
+
+    auto&& snapshot = mica::snapshot_latencies();
+    auto* site = find_site(snapshot, parse_site::id);
+    REQUIRE(site != nullptr);
+    REQUIRE(site->line == parse_site::line);
+    REQUIRE(site->success.count() == 3);
+    REQUIRE(site->failure.count() == 2);
+    REQUIRE(site->failure.percentile(0.5).count() > 0);
+}
+
+TEST_CASE("timed transform times every element")
+{
+    const std::vector<int> input{1, -1, 2, -2, 3};
+    mica::columnar_result<int> output;
+    using policy = mica::timed<std::string, transform_site>;
+    REQUIRE(mica::transform_noexcept<parse_positive, policy>(input, output).has_value());
+
+    auto&& snapshot = mica::snapshot_latencies();
+    auto* site = find_site(snapshot, transform_site::id);
+    REQUIRE(site != nullptr);
+    REQUIRE(site->success.count() == 3);
+    REQUIRE(site->failure.count() == 2);
+}
+
+#if MICA_COUNTERS
+TEST_CASE("timed and counted policies compose")
+{
+    using policy = mica::counted<mica::timed<std::string, both_site>, both_site>;
+    REQUIRE(observed_parse<policy>(1).value() == 1);
+    REQUIRE(observed_parse<policy>(-1).error() == NEGATIVE_MSG);
+
+    auto&& latencies = mica::snapshot_latencies();
+    auto* timed = find_site(latencies, both_site::id);
+    REQUIRE(timed != nullptr);
+    REQUIRE(timed->success.count() == 1);
+    REQUIRE(timed->failure.count() == 1);
+
+    auto&& counters = mica::snapshot_counters();
+    auto* counted = find_site(counters, both_site::id);
+    REQUIRE(counted != nullptr);
+    REQUIRE(counted->calls == 2);
+    REQUIRE(counted->failures == 1);
+}
+#endif
+
+TEST_CASE("latencies are merged across threads")
+{
+    using policy = mica::timed<std::string, thread_site>;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([]() {
+            for (int j = 0; j < 100; ++j) {
+                static_cast<void>(observed_parse<policy>(j % 4 == 0 ? -1 : j));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    static_cast<void>(observed_parse<policy>(1));
+
+    auto&& snapshot = mica::snapshot_latencies();
+    auto* site = find_site(snapshot, thread_site::id);
+    REQUIRE(site != nullptr);
+    REQUIRE(site->success.count() == 301);
+    REQUIRE(site->failure.count() == 100);
+}
+
+TEST_CASE("latencies to_string and to_json")
+{
+    using policy = mica::timed<std::string, report_site>;
+    REQUIRE(observed_parse<policy>(-1).error() == NEGATIVE_MSG);
+    auto&& snapshot = mica::snapshot_latencies();
+
+    auto&& text = mica::to_string(snapshot);
+    REQUIRE(text.find("latency_test.cpp:" + std::to_string(report_site::line) + " failure count 1 ") != std::string::npos);
+    REQUIRE(text.find("ns p999 ") != std::string::npos);
+
+    auto&& json = mica::to_json(snapshot);
+    REQUIRE(json.starts_with("{\"sites\":[{\"id\":\""));
+    REQUIRE(json.find("\"failure\":{\"count\":") != std::string::npos);
+    REQUIRE(json.find(",\"p999\":") != std::string::npos);
+    REQUIRE(json.ends_with("}}]}"));
+}
+#else
+TEST_CASE("timed policy without MICA_LATENCY")
+{
+    using policy = mica::timed<std::string, parse_site>;
+    STATIC_REQUIRE(std::is_same_v<mica::policy_error_t<policy>, std::string>);
+    STATIC_REQUIRE(std::is_same_v<
+        typename mica::policy_traits<policy>::observer,
+        mica::internal::policy_observer_t<std::string>
+    >);
+
+    REQUIRE(observed_parse<policy>(1).value() == 1);
+    REQUIRE(observed_parse<policy>(-1).error() == NEGATIVE_MSG);
+
+    auto&& snapshot = mica::snapshot_latencies();
+    REQUIRE(find_site(snapshot, parse_site::id) == nullptr);
+    REQUIRE(snapshot.sites.empty());
+    REQUIRE(mica::to_json(snapshot) == "{\"sites\":[]}");
+}
+#endif
+
+} // namespace mica_test
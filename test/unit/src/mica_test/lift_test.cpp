@@ -0,0 +1,158 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <expected>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace mica_test {
+
+namespace {
+
+int scale(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument("negative int");
+    }
+    return value * 2;
+}
+
+double scale(double value)
+{
+    if (value < 0) {
+        throw std::invalid_argument("negative double");
+    }
+    return value * 2;
+}
+
+template<typename T>
+T identity(T value)
+{
+    if (value == T()) {
+        throw std::out_of_range("default value");
+    }
+    return value;
+}
+
+class counter {
+public:
+    int add(int value)
+    {
+        if (value < 0) {
+            throw std::invalid_argument("negative add");
+        }
+        return total_ += value;
+    }
+
+    int add(int value) const
+    {
+        return total_ + value;
+    }
+
+    int add(const std::string& text)
+    {
+        return add(std::stoi(text));
+    }
+
+private:
+    int total_ = 0;
+};
+
+namespace adl {
+
+struct token
+{
+    int value;
+};
+
+int unwrap(token t)
+{
+    if (t.value == 0) {
+        throw std::runtime_error("empty token");
+    }
+    return t.value;
+}
+
+} // namespace mica_test::adl
+
+constexpr auto lifted_scale = MICA_LIFT(scale);
+
+static_assert(std::is_empty_v<decltype(lifted_scale)>);
+static_assert(std::is_invocable_r_v<int, decltype(lifted_scale), int>);
+static_assert(std::is_invocable_r_v<double, decltype(lifted_scale), double>);
+static_assert(!std::is_invocable_v<decltype(lifted_scale), std::string>);
+static_assert(!std::is_nothrow_invocable_v<decltype(lifted_scale), int>);
+
+constexpr auto lifted_size = MICA_LIFT_MEMBER(size);
+
+static_assert(std::is_nothrow_invocable_v<decltype(lifted_size), const std::string&>);
+
+} // unnamed namespace
+
+TEST_CASE("lift overload set")
+{
+    REQUIRE(mica::make_noexcept<MICA_LIFT(scale)>(3).value() == 6);
+    REQUIRE(mica::make_noexcept<MICA_LIFT(scale)>(1.5).value() == 3.0);
+    REQUIRE(mica::make_noexcept<MICA_LIFT(scale)>(-1).error() == "negative int");
+    REQUIRE(mica::make_noexcept<MICA_LIFT(scale)>(-1.0).error() == "negative double");
+}
+
+TEST_CASE("lift function template")
+{
+    REQUIRE(mica::make_noexcept<MICA_LIFT(identity)>(5).value() == 5);
+    REQUIRE(mica::make_noexcept<MICA_LIFT(identity), mica::error>(0).error() == mica::errc::out_of_range);
+    REQUIRE(mica::make_noexcept<MICA_LIFT(identity)>(std::string("text")).value() == "text");
+}
+
+TEST_CASE("lift std function with default arguments")
+{
+    REQUIRE(mica::make_noexcept<MICA_LIFT(std::stoi)>(std::string("42")).value() == 42);
+    REQUIRE(mica::make_noexcept<MICA_LIFT(std::stoi)>(std::string("ff"), nullptr, 16).value() == 255);
+    auto&& exp = mica::make_noexcept<MICA_LIFT(std::stoi), mica::error>(std::string("x"));
+    REQUIRE(exp.error() == mica::errc::invalid_argument);
+}
+
+TEST_CASE("lift argument dependent lookup")
+{
+    REQUIRE(mica::make_noexcept<MICA_LIFT(unwrap)>(adl::token{7}).value() == 7);
+    REQUIRE(mica::make_noexcept<MICA_LIFT(unwrap)>(adl::token{0}).error() == "empty token");
+}
+
+TEST_CASE("lift member overload set")
+{
+    counter c;
+    REQUIRE(mica::make_noexcept<MICA_LIFT_MEMBER(add)>(c, 2).value() == 2);
+    REQUIRE(mica::make_noexcept<MICA_LIFT_MEMBER(add)>(c, std::string("3")).value() == 5);
+    REQUIRE(mica::make_noexcept<MICA_LIFT_MEMBER(add)>(c, -1).error() == "negative add");
+    REQUIRE(mica::make_noexcept<MICA_LIFT_MEMBER(add), mica::error>(c, std::string("x")).error()
+        == mica::errc::invalid_argument);
+
+    const counter& view = c;
+    REQUIRE(mica::make_noexcept<MICA_LIFT_MEMBER(add)>(view, -1).value() == 4);
+
+    std::string text("abcdef");
+    REQUIRE(mica::make_noexcept<MICA_LIFT_MEMBER(substr)>(text, 1, 2).value() == "bc");
+    REQUIRE(mica::make_noexcept<MICA_LIFT_MEMBER(substr), mica::error>(text, 7).error() == mica::errc::out_of_range);
+}
+
+TEST_CASE("resolve member function")
+{
+    constexpr auto add = mica::resolve<int(int), counter, &counter::add>();
+    constexpr auto add_const = mica::resolve<int(int) const, counter, &counter::add>();
+    static_assert(std::is_same_v<decltype(add), int (counter::* const)(int)>);
+    static_assert(std::is_same_v<decltype(add_const), int (counter::* const)(int) const>);
+
+    counter c;
+    REQUIRE(mica::make_noexcept<add>(c, 4).value() == 4);
+    REQUIRE(mica::make_noexcept<add>(c, -4).error() == "negative add");
+    const counter& view = c;
+    REQUIRE(mica::make_noexcept<add_const>(view, 1).value() == 5);
+
+    using substr = std::string(std::size_t, std::size_t) const;
+    std::string text("abc");
+    auto&& exp = mica::make_noexcept<mica::resolve<substr, std::string, &std::string::substr>()>(text, 1, 1);
+    REQUIRE(exp.value() == "b");
+}
+
+} // namespace mica_test
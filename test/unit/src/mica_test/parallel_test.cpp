@@ -0,0 +1,201 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstddef>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+constexpr const std::string ERROR_MSG("negative");
+
+int checked_double(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument(ERROR_MSG);
+    }
+    return value * 2;
+}
+
+bool checked_even(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument(ERROR_MSG);
+    }
+    return value % 2 == 0;
+}
+
+std::vector<int> make_input(std::size_t count, std::size_t failure_period)
+{
+    std::vector<int> input(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        input[i] = failure_period != 0 && i % failure_period == failure_period - 1 ? -1 : static_cast<int>(i);
+    }
+    return input;
+}
+
+} // unnamed namespace
+
+TEST_CASE("thread_pool runs every index once")
+{
+    mica::thread_pool pool(4);
+    REQUIRE(pool.size() == 4);
+    std::vector<std::atomic<int>> calls(10000);
+    pool.run(calls.size(), [&](std::size_t index) noexcept {
+        calls[index].fetch_add(1, std::memory_order_relaxed);
+    });
+    for (const auto& count : calls) {
+        REQUIRE(count.load() == 1);
+    }
+}
+
+TEST_CASE("thread_pool runs several jobs")
+{
+    mica::thread_pool pool(3);
+    for (std::size_t count : {0, 1, 2, 3, 7, 1000}) {
+        std::atomic<std::size_t> sum{0};
+        pool.run(count, [&](std::size_t index) noexcept {
+            sum.fetch_add(index, std::memory_order_relaxed);
+        });
+        REQUIRE(sum.load() == count * (count == 0 ? 0 : count - 1) / 2);
+    }
+}
+
+TEST_CASE("thread_pool with a single worker")
+{
+    mica::thread_pool pool(0);
+    REQUIRE(pool.size() == 1);
+    std::size_t calls = 0;
+    pool.run(5, [&](std::size_t) noexcept {
+        ++calls;
+    });
+    REQUIRE(calls == 5);
+}
+
+TEST_CASE("thread_pool runs nested jobs inline")
+{
+    mica::thread_pool pool(4);
+    std::vector<std::atomic<int>> calls(64 * 64);
+    pool.run(64, [&](std::size_t outer) noexcept {
+        pool.run(64, [&](std::size_t inner) noexcept {
+            calls[outer * 64 + inner].fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+    for (const auto& count : calls) {
+        REQUIRE(count.load() == 1);
+    }
+}
+
+TEST_CASE("parallel_transform_noexcept nested on the same pool")
+{
+    mica::thread_pool pool(4);
+    const auto input = make_input(mica::transform_chunk_size + 1, 0);
+    std::vector<mica::columnar_result<int>> outputs(8);
+    pool.run(outputs.size(), [&](std::size_t index) noexcept {
+        static_cast<void>(mica::parallel_transform_noexcept<checked_double>(input, outputs[index], pool));
+    });
+    for (const auto& output : outputs) {
+        REQUIRE(output.size() == input.size());
+        REQUIRE(output.values()[input.size() - 1] == 2 * input.back());
+    }
+}
+
+TEST_CASE("parallel_transform_noexcept")
+{
+    mica::thread_pool pool(4);
+    const auto input = make_input(10 * mica::transform_chunk_size + 3, 0);
+    mica::columnar_result<int> output;
+    auto&& exp = mica::parallel_transform_noexcept<checked_double>(input, output, pool);
+    REQUIRE(exp.has_value());
+    REQUIRE(output.size() == input.size());
+    REQUIRE(output.failure_count() == 0);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        REQUIRE(output.values()[i] == 2 * input[i]);
+    }
+}
+
+TEST_CASE("parallel_transform_noexcept bool values")
+{
+    mica::thread_pool pool(4);
+    const auto input = make_input(10 * mica::transform_chunk_size + 3, 7);
+    mica::columnar_result<bool> output;
+    auto&& exp = mica::parallel_transform_noexcept<checked_even>(input, output, pool);
+    REQUIRE(exp.has_value());
+    REQUIRE(output.size() == input.size());
+    REQUIRE(output.failure_count() == input.size() / 7);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        REQUIRE(output.values()[i] == (input[i] >= 0 && input[i] % 2 == 0));
+    }
+}
+
+TEST_CASE("parallel_transform_noexcept collects failures")
+{
+    mica::thread_pool pool(4);
+    const auto input = make_input(10 * mica::transform_chunk_size, 97);
+    mica::columnar_result<int, mica::error> output;
+    auto&& exp = mica::parallel_transform_noexcept<checked_double, mica::error>(input, output, pool);
+    REQUIRE(exp.has_value());
+    REQUIRE(output.size() == input.size());
+    REQUIRE(output.failure_count() == input.size() / 97);
+    std::size_t previous = 0;
+    for (const auto& failure : output.errors()) {
+        REQUIRE(failure.index % 97 == 96);
+        REQUIRE(failure.index >= previous);
+        REQUIRE(failure.error == mica::errc::invalid_argument);
+        previous = failure.index;
+    }
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        REQUIRE(output.failed(i) == (i % 97 == 96));
+    }
+}
+
+TEST_CASE("parallel_transform_noexcept appends to output")
+{
+    mica::thread_pool pool(2);
+    mica::columnar_result<int> output;
+    REQUIRE(mica::parallel_transform_noexcept<checked_double>(std::vector<int>{1, -1}, output, pool).has_value());
+    REQUIRE(mica::parallel_transform_noexcept<checked_double>(std::vector<int>{-1, 3}, output, pool).has_value());
+    REQUIRE(output.size() == 4);
+    REQUIRE(output.failure_count() == 2);
+    REQUIRE(output.errors()[0].index == 1);
+    REQUIRE(output.errors()[1].index == 2);
+    REQUIRE(output.values()[3] == 6);
+}
+
+TEST_CASE("parallel_transform_noexcept cancels on failure")
+{
+    mica::thread_pool pool(4);
+    const auto input = make_input(50 * mica::transform_chunk_size, 1000);
+    mica::columnar_result<int> output;
+    REQUIRE(mica::parallel_transform_noexcept<checked_double>(std::vector<int>{1}, output, pool).has_value());
+    auto&& exp = mica::parallel_transform_noexcept<checked_double>(
+        input,
+        output,
+        pool,
+        mica::failure_mode::cancel
+    );
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == ERROR_MSG);
+    REQUIRE(output.size() == 1);
+    REQUIRE(output.failure_count() == 0);
+}
+
+TEST_CASE("parallel_transform_noexcept cancel without failures")
+{
+    mica::thread_pool pool(4);
+    const auto input = make_input(3 * mica::transform_chunk_size, 0);
+    mica::columnar_result<int> output;
+    auto&& exp = mica::parallel_transform_noexcept<checked_double>(
+        input,
+        output,
+        pool,
+        mica::failure_mode::cancel
+    );
+    REQUIRE(exp.has_value());
+    REQUIRE(output.size() == input.size());
+}
+
+} // namespace mica_test
@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+#include <charconv>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <mica/mica.hpp>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace mica_test {
+
+namespace {
+
+static_assert(mica::parsable<int>);
+static_assert(mica::parsable<std::uint64_t>);
+static_assert(mica::parsable<double>);
+static_assert(!mica::parsable<bool>);
+static_assert(!mica::parsable<char>);
+static_assert(mica::parsable<std::uint8_t>);
+static_assert(!mica::parsable<std::string>);
+
+// What std::from_chars makes of the whole text
+template<typename T>
+std::expected<T, mica::errc> reference(std::string_view text)
+{
+    T value;
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (ec == std::errc::result_out_of_range) {
+        return std::unexpected(mica::errc::out_of_range);
+    }
+    if (ec != std::errc() || ptr != text.data() + text.size()) {
+        return std::unexpected(mica::errc::invalid_argument);
+    }
+    return value;
+}
+
+template<typename T>
+void require_same_as_from_chars(std::string_view text)
+{
+    INFO(text);
+    REQUIRE(mica::internal::parse_field<T>(text.data(), text.data() + text.size()) == reference<T>(text));
+}
+
+std::expected<int, mica::error> sum(std::string_view a, std::string_view b) noexcept
+{
+    MICA_TRY_DECL(int x, (mica::parse<int, mica::error>(a)));
+    MICA_TRY_DECL(int y, (mica::parse<int, mica::error>(b)));
+    return x + y;
+}
+
+} // unnamed namespace
+
+TEST_CASE("parse integers")
+{
+    REQUIRE(mica::parse<int>("0").value() == 0);
+    REQUIRE(mica::parse<int>("42").value() == 42);
+    REQUIRE(mica::parse<int>("-42").value() == -42);
+    REQUIRE(mica::parse<int>("000000000042").value() == 42);
+    REQUIRE(mica::parse<int>("2147483647").value() == std::numeric_limits<int>::max());
+    REQUIRE(mica::parse<int>("-2147483648").value() == std::numeric_limits<int>::min());
+    REQUIRE(mica::parse<std::uint64_t>("18446744073709551615").value() == std::numeric_limits<std::uint64_t>::max());
+    REQUIRE(mica::parse<std::int64_t>("-123456789012345678").value() == -123456789012345678);
+    REQUIRE(mica::parse<std::int8_t>("-128").value() == -128);
+}
+
+TEST_CASE("parse integer errors")
+{
+    REQUIRE(mica::parse<int>("").error() == "invalid argument");
+    REQUIRE(mica::parse<int, mica::error>("-").error() == mica::errc::invalid_argument);
+    REQUIRE(mica::parse<int, mica::error>("+1").error() == mica::errc::invalid_argument);
+    REQUIRE(mica::parse<int, mica::error>(" 1").error() == mica::errc::invalid_argument);
+    REQUIRE(mica::parse<int, mica::error>("12a").error() == mica::errc::invalid_argument);
+    REQUIRE(mica::parse<int, mica::error>("1234567a9").error() == mica::errc::invalid_argument);
+    REQUIRE(mica::parse<int, mica::error>("2147483648").error() == mica::errc::out_of_range);
+    REQUIRE(mica::parse<unsigned, mica::error>("-1").error() == mica::errc::invalid_argument);
+    REQUIRE(mica::parse<std::uint8_t, mica::error>("256").error() == mica::errc::out_of_range);
+}
+
+TEST_CASE("parse floating point")
+{
+    REQUIRE(mica::parse<double>("1.5").value() == 1.5);
+    REQUIRE(mica::parse<double>("-2.5e3").value() == -2500.0);
+    REQUIRE(mica::parse<float>("0.25").value() == 0.25f);
+    REQUIRE(mica::parse<double, mica::error>("1.5x").error() == mica::errc::invalid_argument);
+    REQUIRE(mica::parse<double, mica::error>("1e999").error() == mica::errc::out_of_range);
+}
+
+TEST_CASE("parse matches from_chars")
+{
+    std::mt19937_64 random(12345);
+    const std::string_view alphabet = "0123456789-/:09";
+    for (int i = 0; i < 20000; ++i) {
+        std::string text;
+        const std::size_t length = random() % 24;
+        for (std::size_t j = 0; j < length; ++j) {
+            // Mostly digits, so that most texts are numbers
+            text += random() % 8 == 0 ? alphabet[random() % alphabet.size()] : static_cast<char>('0' + random() % 10);
+        }
+        require_same_as_from_chars<int>(text);
+        require_same_as_from_chars<unsigned>(text);
+        require_same_as_from_chars<std::int64_t>(text);
+        require_same_as_from_chars<std::uint64_t>(text);
+        require_same_as_from_chars<std::int16_t>(text);
+    }
+}
+
+TEST_CASE("parse with MICA_TRY_DECL")
+{
+    REQUIRE(sum("1", "2").value() == 3);
+    REQUIRE(sum("1", "two").error() == mica::errc::invalid_argument);
+}
+
+TEST_CASE("parse_column")
+{
+    mica::try_vector<std::expected<int, mica::errc>> column;
+    REQUIRE(mica::parse_column<int>("1,-2,x,,99999999999,12345678", ',', column).has_value());
+    REQUIRE(column.size() == 6);
+    REQUIRE(column[0] == 1);
+    REQUIRE(column[1] == -2);
+    REQUIRE(column[2].error() == mica::errc::invalid_argument);
+    REQUIRE(column[3].error() == mica::errc::invalid_argument);
+    REQUIRE(column[4].error() == mica::errc::out_of_range);
+    REQUIRE(column[5] == 12345678);
+}
+
+TEST_CASE("parse_column lines")
+{
+    mica::try_vector<std::expected<double, mica::errc>> column;
+    REQUIRE(mica::parse_column<double>("1.5\n2.5\n", '\n', column).has_value());
+    REQUIRE(column.size() == 2);
+    REQUIRE(column[1] == 2.5);
+
+    // Appends
+    REQUIRE(mica::parse_column<double>("3.5", '\n', column).has_value());
+    REQUIRE(column.size() == 3);
+
+    REQUIRE(mica::parse_column<double>("", '\n', column).has_value());
+    REQUIRE(column.size() == 3);
+}
+
+} // namespace mica_test
@@ -0,0 +1,221 @@
+#include <catch2/catch_test_macros.hpp>
+#include <expected>
+#include <mica/mica.hpp>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace mica_test {
+
+namespace {
+
+struct to_error_code {
+    std::error_code operator()(const std::system_error& e) const
+    {
+        return e.code();
+    }
+};
+
+struct oom {
+    std::error_code operator()() const
+    {
+        return std::make_error_code(std::errc::not_enough_memory);
+    }
+};
+
+struct unknown_error {
+    std::error_code operator()() const
+    {
+        return std::make_error_code(std::errc::state_not_recoverable);
+    }
+};
+
+using error_code_policy = mica::translators<
+    mica::on<std::system_error, to_error_code>,
+    mica::on<std::bad_alloc, oom>,
+    mica::otherwise<unknown_error>
+>;
+
+struct invalid_argument_error {
+    mica::error operator()() const
+    {
+        return "invalid argument translated";
+    }
+};
+
+using error_policy = mica::translators<
+    mica::on<std::invalid_argument, invalid_argument_error>
+>;
+
+struct first {
+    std::string operator()(const std::runtime_error&) const
+    {
+        return "first";
+    }
+};
+
+struct second {
+    std::string operator()(const std::exception&) const
+    {
+        return "second";
+    }
+};
+
+using ordered_policy = mica::translators<
+    mica::on<std::runtime_error, first>,
+    mica::on<std::exception, second>
+>;
+
+int throws_system_error(int a)
+{
+    if (a != 0) {
+        throw std::system_error(std::make_error_code(std::errc::permission_denied));
+    }
+    return a;
+}
+
+int throws_bad_alloc()
+{
+    throw std::bad_alloc();
+}
+
+int throws_invalid_argument()
+{
+    throw std::invalid_argument("invalid");
+}
+
+int throws_logic_error()
+{
+    throw std::logic_error("logic");
+}
+
+int throws_out_of_range()
+{
+    throw std::out_of_range("out of range");
+}
+
+int throws_int()
+{
+    throw 42;
+}
+
+class member_function_test {
+public:
+    int test_func(int a) const
+    {
+        return throws_system_error(a);
+    }
+};
+
+} // unnamed namespace
+
+static_assert(std::is_same_v<mica::policy_error_t<error_code_policy>, std::error_code>);
+static_assert(std::is_same_v<mica::policy_error_t<std::string>, std::string>);
+
+TEST_CASE("translators success")
+{
+    auto&& exp = mica::make_noexcept<throws_system_error, error_code_policy>(0);
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 0);
+}
+
+TEST_CASE("translators keep system_error code")
+{
+    auto&& exp = mica::make_noexcept<throws_system_error, error_code_policy>(1);
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == std::errc::permission_denied);
+}
+
+TEST_CASE("translators map to fixed value")
+{
+    auto&& exp = mica::make_noexcept<throws_bad_alloc, error_code_policy>();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == std::errc::not_enough_memory);
+}
+
+TEST_CASE("translators otherwise")
+{
+    {
+        auto&& exp = mica::make_noexcept<throws_invalid_argument, error_code_policy>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == std::errc::state_not_recoverable);
+    }
+    {
+        auto&& exp = mica::make_noexcept<throws_int, error_code_policy>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == std::errc::state_not_recoverable);
+    }
+}
+
+TEST_CASE("translators fall back to error_traits")
+{
+    {
+        auto&& exp = mica::make_noexcept<throws_invalid_argument, error_policy>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error().category() == mica::error_category::user);
+        REQUIRE(std::string_view(exp.error().message()) == "invalid argument translated");
+    }
+    {
+        auto&& exp = mica::make_noexcept<throws_out_of_range, error_policy>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == mica::errc::out_of_range);
+    }
+    {
+        auto&& exp = mica::make_noexcept<throws_int, error_policy>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == mica::errc::unknown);
+    }
+}
+
+TEST_CASE("translators are tried in order")
+{
+    {
+        auto&& exp = mica::make_noexcept<throws_system_error, ordered_policy>(1);
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == "first");
+    }
+    {
+        auto&& exp = mica::make_noexcept<throws_logic_error, ordered_policy>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == "second");
+    }
+    {
+        auto&& exp = mica::make_noexcept<throws_int, ordered_policy>();
+        REQUIRE_FALSE(exp.has_value());
+        REQUIRE(exp.error() == "unexpected error");
+    }
+}
+
+TEST_CASE("translators member function")
+{
+    member_function_test m;
+    auto&& exp = mica::make_noexcept<&member_function_test::test_func, error_code_policy>(m, 1);
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == std::errc::permission_denied);
+}
+
+TEST_CASE("translators capturing lambda")
+{
+    int a = 1;
+    auto&& lambda = [&a]() -> int {
+        return throws_system_error(a);
+    };
+    auto&& exp = mica::make_noexcept<error_code_policy>(lambda);
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == std::errc::permission_denied);
+}
+
+TEST_CASE("MICA_TRY translators")
+{
+    auto&& exp = []() noexcept -> std::expected<int, std::error_code> {
+        int output = 0;
+        MICA_TRY(output, (mica::make_noexcept<throws_system_error, error_code_policy>(1)));
+        return output;
+    }();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == std::errc::permission_denied);
+}
+
+} // namespace mica_test
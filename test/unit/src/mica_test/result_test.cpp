@@ -0,0 +1,170 @@
+#include <catch2/catch_test_macros.hpp>
+#include <expected>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mica_test {
+
+namespace {
+
+constexpr const std::string ERROR_MSG("negative");
+
+int resumed_after_failure = 0;
+
+std::expected<int, std::string> check(int value)
+{
+    if (value < 0) {
+        return std::unexpected(ERROR_MSG);
+    }
+    return value;
+}
+
+mica::result<int> add(int a, int b)
+{
+    int first = co_await check(a);
+    int second = co_await check(b);
+    ++resumed_after_failure;
+    co_return first + second;
+}
+
+mica::result<int> add_nested(int a, int b, int c)
+{
+    co_return co_await add(a, b) + co_await check(c);
+}
+
+mica::result<void> validate(int value)
+{
+    co_await check(value);
+}
+
+mica::result<int> validate_then_double(int value)
+{
+    co_await validate(value);
+    co_return value * 2;
+}
+
+mica::result<int> from_lvalue(int value)
+{
+    auto&& exp = check(value);
+    int output = co_await exp;
+    co_return output;
+}
+
+mica::result<std::string> move_only_error(int value)
+{
+    std::expected<std::string, std::string> exp = std::to_string(value);
+    if (value < 0) {
+        exp = std::unexpected(ERROR_MSG);
+    }
+    co_return co_await std::move(exp);
+}
+
+std::expected<std::string, std::string> text_of(int value)
+{
+    if (value < 0) {
+        return std::unexpected(ERROR_MSG);
+    }
+    return std::string(32, static_cast<char>('0' + value));
+}
+
+mica::result<char> first_char(int value)
+{
+    // Outlives the awaited temporary
+    const auto& text = co_await text_of(value);
+    co_return text[0];
+}
+
+mica::result<int, mica::error> throwing(int value)
+{
+    if (value < 0) {
+        throw std::out_of_range("negative");
+    }
+    co_return value;
+}
+
+mica::result<int, mica::error> converting(int value)
+{
+    std::expected<int, mica::errc> exp = value;
+    if (value < 0) {
+        exp = std::unexpected(mica::errc::invalid_argument);
+    }
+    co_return co_await exp;
+}
+
+} // unnamed namespace
+
+TEST_CASE("result")
+{
+    std::expected<int, std::string> exp = add(1, 2);
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 3);
+    REQUIRE(add(3, 4).get().value() == 7);
+}
+
+TEST_CASE("result returns early")
+{
+    resumed_after_failure = 0;
+    auto&& exp = add(1, -2).get();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == ERROR_MSG);
+    REQUIRE(resumed_after_failure == 0);
+}
+
+TEST_CASE("result co_await result")
+{
+    REQUIRE(add_nested(1, 2, 3).get().value() == 6);
+    REQUIRE(add_nested(-1, 2, 3).get().error() == ERROR_MSG);
+    REQUIRE(add_nested(1, 2, -3).get().error() == ERROR_MSG);
+}
+
+TEST_CASE("result<void>")
+{
+    REQUIRE(validate(1).get().has_value());
+    REQUIRE(validate(-1).get().error() == ERROR_MSG);
+    REQUIRE(validate_then_double(2).get().value() == 4);
+    REQUIRE(validate_then_double(-2).get().error() == ERROR_MSG);
+}
+
+TEST_CASE("result co_await lvalue")
+{
+    REQUIRE(from_lvalue(5).get().value() == 5);
+    REQUIRE(from_lvalue(-5).get().error() == ERROR_MSG);
+}
+
+TEST_CASE("result co_await rvalue")
+{
+    REQUIRE(move_only_error(5).get().value() == "5");
+    REQUIRE(move_only_error(-5).get().error() == ERROR_MSG);
+}
+
+TEST_CASE("result co_await temporary")
+{
+    REQUIRE(first_char(7).get().value() == '7');
+    REQUIRE(first_char(-1).get().error() == ERROR_MSG);
+}
+
+TEST_CASE("result converts errors")
+{
+    REQUIRE(converting(5).get().value() == 5);
+    REQUIRE(converting(-5).get().error() == mica::errc::invalid_argument);
+}
+
+TEST_CASE("result exceptions become errors")
+{
+    REQUIRE(throwing(1).get().value() == 1);
+    REQUIRE(throwing(-1).get().error() == mica::errc::out_of_range);
+}
+
+TEST_CASE("result frames are recycled")
+{
+    REQUIRE(add(1, 2).get().value() == 3);
+    const auto cached = mica::cached_frames();
+    const auto allocated = mica::allocated_frames();
+    REQUIRE(add(1, 2).get().value() == 3);
+    REQUIRE(mica::cached_frames() == cached);
+    REQUIRE(mica::allocated_frames() - allocated <= 1);
+}
+
+} // namespace mica_test
@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstring>
+#include <expected>
+#include <mica/mica.hpp>
+#include <mica_test/site_helpers.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+const std::string SUPPRESSED_MSG("suppressed");
+
+using one_in_site = MICA_CALL_SITE;
+
+std::expected<int, std::string> one_in_parse(int value) noexcept
+{
+    using policy = mica::sampled<std::string, one_in_site, mica::one_in<3>>;
+    return observed_parse<policy>(value);
+}
+
+using rate_site = MICA_CALL_SITE;
+
+std::expected<int, std::string> rate_parse(int value) noexcept
+{
+    using policy = mica::sampled<std::string, rate_site, mica::rate_limited<1, 2>>;
+    return observed_parse<policy>(value);
+}
+
+std::expected<int, mica::error> error_parse(int value) noexcept
+{
+    using policy = mica::sampled<mica::error, MICA_CALL_SITE, mica::one_in<2>>;
+    return observed_parse<policy>(value);
+}
+
+struct negative
+{
+    std::string operator()() const
+    {
+        return "translated";
+    }
+};
+
+std::expected<int, std::string> translated_parse(int value) noexcept
+{
+    using policy = mica::sampled<
+        mica::translators<mica::on<std::invalid_argument, negative>>,
+        MICA_CALL_SITE,
+        mica::one_in<1000>
+    >;
+    return observed_parse<policy>(value);
+}
+
+} // unnamed namespace
+
+TEST_CASE("sampled one_in")
+{
+    REQUIRE(one_in_parse(1).value() == 1);
+    std::vector<std::string> errors;
+    for (int i = 0; i < 9; ++i) {
+        errors.push_back(one_in_parse(-1).error());
+    }
+    for (std::size_t i = 0; i < errors.size(); ++i) {
+        REQUIRE(errors[i] == (i % 3 == 0 ? NEGATIVE_MSG : SUPPRESSED_MSG));
+    }
+}
+
+TEST_CASE("sampled state is per thread")
+{
+    std::string first;
+    std::thread thread([&]() {
+        first = one_in_parse(-1).error();
+    });
+    thread.join();
+    REQUIRE(first == NEGATIVE_MSG);
+}
+
+TEST_CASE("sampled rate_limited")
+{
+    REQUIRE(rate_parse(-1).error() == NEGATIVE_MSG);
+    REQUIRE(rate_parse(-1).error() == NEGATIVE_MSG);
+    REQUIRE(rate_parse(-1).error() == SUPPRESSED_MSG);
+    REQUIRE(rate_parse(-1).error() == SUPPRESSED_MSG);
+}
+
+TEST_CASE("token_bucket")
+{
+    mica::internal::token_bucket bucket;
+    REQUIRE(bucket.take(1, 3));
+    REQUIRE(bucket.take(1, 3));
+    REQUIRE(bucket.take(1, 3));
+    REQUIRE_FALSE(bucket.take(1, 3));
+
+    bucket.refilled -= std::chrono::nanoseconds(std::chrono::milliseconds(2500)).count();
+    REQUIRE(bucket.take(1, 3));
+    REQUIRE(bucket.take(1, 3));
+    REQUIRE_FALSE(bucket.take(1, 3));
+}
+
+TEST_CASE("sampled mica::error")
+{
+    auto&& captured = error_parse(-1);
+    REQUIRE(captured.error() == mica::errc::invalid_argument);
+    REQUIRE(std::strcmp(captured.error().message(), "invalid argument") == 0);
+
+    auto&& suppressed = error_parse(-1);
+    REQUIRE(suppressed.error() == mica::errc::invalid_argument);
+    REQUIRE(std::strcmp(suppressed.error().message(), "message suppressed") == 0);
+}
+
+TEST_CASE("sampled translators")
+{
+    REQUIRE(translated_parse(-1).error() == "translated");
+    REQUIRE(translated_parse(-1).error() == "translated");
+}
+
+TEST_CASE("suppressed_error")
+{
+    REQUIRE(mica::internal::suppressed_error<std::string>(mica::errc::out_of_range) == "suppressed");
+    REQUIRE(mica::internal::suppressed_error<std::string>(mica::errc::out_of_range).capacity()
+        == std::string().capacity());
+    REQUIRE(mica::internal::suppressed_error<mica::interned>(mica::errc::out_of_range).view() == "out of range");
+    REQUIRE(mica::internal::suppressed_error<mica::with_context<std::string>>(mica::errc::out_of_range).error()
+        == "suppressed");
+}
+
+} // namespace mica_test
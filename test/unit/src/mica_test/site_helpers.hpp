@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace mica_test {
+
+// Shared by the tests of the policies observing a call site. The sites
+// themselves are declared with MICA_CALL_SITE in each test file, a site
+// declared here would be shared by every file including it.
+
+// Does not fit in SSO, so capturing it allocates
+inline const std::string NEGATIVE_MSG("value must not be negative, got a negative value");
+
+inline int parse_positive(int value)
+{
+    if (value == 0) {
+        throw std::out_of_range("zero");
+    }
+    if (value < 0) {
+        throw std::invalid_argument(NEGATIVE_MSG);
+    }
+    return value;
+}
+
+// parse_positive through make_noexcept with Policy, which names the site
+template<typename Policy>
+auto observed_parse(int value) noexcept
+{
+    return mica::make_noexcept<parse_positive, Policy>(value);
+}
+
+// The entry of the site in a counter or latency snapshot, nullptr when the
+// site was not observed
+template<typename Snapshot>
+const auto* find_site(const Snapshot& snapshot, std::uint64_t id)
+{
+    for (const auto& site : snapshot.sites) {
+        if (site.id == id) {
+            return &site;
+        }
+    }
+    return static_cast<decltype(&snapshot.sites[0])>(nullptr);
+}
+
+} // namespace mica_test
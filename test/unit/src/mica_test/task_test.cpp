@@ -0,0 +1,239 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <expected>
+#include <mica/mica.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+constexpr const std::string ERROR_MSG("odd value");
+
+std::atomic<int> resumed_after_failure{0};
+
+mica::task<int> constant(int value)
+{
+    co_return value;
+}
+
+mica::task<std::expected<int, std::string>> halve(int value)
+{
+    if (value % 2 != 0) {
+        co_return std::unexpected(ERROR_MSG);
+    }
+    co_return value / 2;
+}
+
+mica::task<std::expected<int, std::string>> quarter(int value)
+{
+    int half = co_await halve(value);
+    ++resumed_after_failure;
+    co_return co_await halve(half);
+}
+
+mica::task<std::expected<int, std::string>> quarter_plain(int value)
+{
+    std::expected<int, std::string> exp = co_await halve(value).as_expected();
+    if (!exp.has_value()) {
+        co_return std::unexpected("plain: " + exp.error());
+    }
+    co_return *exp / 2;
+}
+
+std::expected<int, std::string> parse_even(int value)
+{
+    if (value % 2 != 0) {
+        return std::unexpected(ERROR_MSG);
+    }
+    return value;
+}
+
+mica::task<std::expected<int, std::string>> sum_even(int a, int b)
+{
+    int first = co_await parse_even(a);
+    int second = co_await parse_even(b);
+    co_return first + second;
+}
+
+mica::task<std::expected<int, mica::error>> throwing(int value)
+{
+    if (value < 0) {
+        throw std::out_of_range("negative");
+    }
+    co_return value;
+}
+
+std::expected<std::string, std::string> text_of(int value)
+{
+    if (value < 0) {
+        return std::unexpected(ERROR_MSG);
+    }
+    return std::string(32, static_cast<char>('0' + value));
+}
+
+mica::task<std::expected<char, std::string>> first_char(int value)
+{
+    // Outlives the awaited temporary
+    auto&& text = co_await text_of(value);
+    co_return text[0];
+}
+
+mica::task<std::expected<void, std::string>> check_even(int value)
+{
+    co_await halve(value);
+    co_return std::expected<void, std::string>();
+}
+
+mica::task<int> deep(int depth)
+{
+    if (depth == 0) {
+        co_return 0;
+    }
+    co_return co_await deep(depth - 1) + 1;
+}
+
+mica::task<std::thread::id> thread_of(mica::thread_executor& executor)
+{
+    co_await executor.schedule();
+    co_return std::this_thread::get_id();
+}
+
+mica::task<std::expected<int, std::string>> on_executor(mica::thread_executor& executor, int value)
+{
+    co_await executor.schedule();
+    co_return co_await quarter(value);
+}
+
+mica::task<int> on_loop(mica::run_loop& loop, int value)
+{
+    co_await loop.schedule();
+    co_return value;
+}
+
+mica::task<int> loop_sum(mica::run_loop& loop)
+{
+    int sum = 0;
+    for (int i = 1; i <= 10; ++i) {
+        sum += co_await on_loop(loop, i);
+    }
+    co_return sum;
+}
+
+} // unnamed namespace
+
+TEST_CASE("task")
+{
+    REQUIRE(mica::sync_wait(constant(7)) == 7);
+}
+
+TEST_CASE("task co_await task<expected>")
+{
+    auto&& exp = mica::sync_wait(quarter(12));
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 3);
+}
+
+TEST_CASE("task co_await task<expected> error")
+{
+    resumed_after_failure = 0;
+    auto&& exp = mica::sync_wait(quarter(7));
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == ERROR_MSG);
+    REQUIRE(resumed_after_failure == 0);
+
+    auto&& nested = mica::sync_wait(quarter(6));
+    REQUIRE_FALSE(nested.has_value());
+    REQUIRE(resumed_after_failure == 1);
+}
+
+TEST_CASE("task as_expected")
+{
+    auto&& exp = mica::sync_wait(quarter_plain(5));
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == "plain: " + ERROR_MSG);
+}
+
+TEST_CASE("task co_await expected")
+{
+    REQUIRE(mica::sync_wait(sum_even(2, 4)).value() == 6);
+    auto&& exp = mica::sync_wait(sum_even(2, 3));
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == ERROR_MSG);
+}
+
+TEST_CASE("task co_await temporary expected")
+{
+    REQUIRE(mica::sync_wait(first_char(7)).value() == '7');
+    REQUIRE(mica::sync_wait(first_char(-1)).error() == ERROR_MSG);
+}
+
+TEST_CASE("task<expected<void>>")
+{
+    REQUIRE(mica::sync_wait(check_even(4)).has_value());
+    REQUIRE_FALSE(mica::sync_wait(check_even(3)).has_value());
+}
+
+TEST_CASE("task exceptions become errors")
+{
+    auto&& exp = mica::sync_wait(throwing(-1));
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == mica::errc::out_of_range);
+}
+
+TEST_CASE("task nested")
+{
+    REQUIRE(mica::sync_wait(deep(1000)) == 1000);
+}
+
+TEST_CASE("task frames are recycled")
+{
+    REQUIRE(mica::sync_wait(deep(10)) == 10);
+    const auto cached = mica::cached_frames();
+    REQUIRE(cached > 0);
+    REQUIRE(mica::sync_wait(deep(10)) == 10);
+    REQUIRE(mica::cached_frames() == cached);
+}
+
+TEST_CASE("run_loop")
+{
+    mica::run_loop loop;
+    REQUIRE(loop.run(loop_sum(loop)) == 55);
+    REQUIRE(loop.run(constant(3)) == 3);
+}
+
+TEST_CASE("thread_executor")
+{
+    mica::thread_executor executor(2);
+    REQUIRE(executor.size() == 2);
+    REQUIRE(mica::sync_wait(thread_of(executor)) != std::this_thread::get_id());
+
+    auto&& exp = mica::sync_wait(on_executor(executor, 20));
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 5);
+    REQUIRE_FALSE(mica::sync_wait(on_executor(executor, 10)).has_value());
+}
+
+TEST_CASE("thread_executor many tasks")
+{
+    mica::thread_executor executor(4);
+    std::vector<std::thread> callers;
+    std::atomic<int> sum{0};
+    for (int i = 0; i < 4; ++i) {
+        callers.emplace_back([&, i]() {
+            for (int j = 0; j < 100; ++j) {
+                auto&& exp = mica::sync_wait(on_executor(executor, 4 * (i * 100 + j)));
+                sum += exp.value();
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    REQUIRE(sum == 399 * 400 / 2);
+}
+
+} // namespace mica_test
@@ -0,0 +1,177 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <forward_list>
+#include <mica/mica.hpp>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mica_test {
+
+namespace {
+
+constexpr const std::string ERROR_MSG("negative");
+
+int checked_double(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument(ERROR_MSG);
+    }
+    return value * 2;
+}
+
+bool checked_even(int value)
+{
+    if (value < 0) {
+        throw std::invalid_argument(ERROR_MSG);
+    }
+    return value % 2 == 0;
+}
+
+struct negative_message
+{
+    mica::error operator()() const noexcept
+    {
+        return "negative value";
+    }
+};
+
+} // unnamed namespace
+
+TEST_CASE("transform_noexcept")
+{
+    std::vector<int> input{1, 2, 3, 4};
+    mica::columnar_result<int> output;
+    auto&& exp = mica::transform_noexcept<checked_double>(input, output);
+    REQUIRE(exp.has_value());
+    REQUIRE(output.size() == 4);
+    REQUIRE(output.failure_count() == 0);
+    REQUIRE(std::ranges::equal(output.values(), std::vector<int>{2, 4, 6, 8}));
+    for (std::size_t i = 0; i < output.size(); ++i) {
+        REQUIRE_FALSE(output.failed(i));
+    }
+}
+
+TEST_CASE("transform_noexcept failures")
+{
+    std::vector<int> input{1, -2, 3, -4, 5};
+    mica::columnar_result<int> output;
+    auto&& exp = mica::transform_noexcept<checked_double>(input, output);
+    REQUIRE(exp.has_value());
+    REQUIRE(output.size() == 5);
+    REQUIRE(std::ranges::equal(output.values(), std::vector<int>{2, 0, 6, 0, 10}));
+    REQUIRE(output.failure_count() == 2);
+    REQUIRE(output.failed(1));
+    REQUIRE(output.failed(3));
+    REQUIRE_FALSE(output.failed(0));
+    REQUIRE_FALSE(output.failed(4));
+    REQUIRE(output.errors()[0].index == 1);
+    REQUIRE(output.errors()[0].error == ERROR_MSG);
+    REQUIRE(output.errors()[1].index == 3);
+}
+
+TEST_CASE("transform_noexcept spans several chunks")
+{
+    const std::size_t count = 3 * mica::transform_chunk_size + 7;
+    std::vector<int> input;
+    for (std::size_t i = 0; i < count; ++i) {
+        input.push_back(i % 100 == 99 ? -1 : static_cast<int>(i));
+    }
+    mica::columnar_result<int, mica::error> output;
+    auto&& exp = mica::transform_noexcept<checked_double, mica::error>(input, output);
+    REQUIRE(exp.has_value());
+    REQUIRE(output.size() == count);
+    REQUIRE(output.failure_count() == count / 100);
+    for (std::size_t i = 0; i < count; ++i) {
+        REQUIRE(output.failed(i) == (i % 100 == 99));
+        if (!output.failed(i)) {
+            REQUIRE(output.values()[i] == static_cast<int>(2 * i));
+        }
+    }
+    for (const auto& failure : output.errors()) {
+        REQUIRE(failure.index % 100 == 99);
+        REQUIRE(failure.error == mica::errc::invalid_argument);
+    }
+}
+
+TEST_CASE("transform_noexcept grows a sized input only to its reservation")
+{
+    std::vector<int> input(1000, 1);
+    mica::columnar_result<int> output;
+    REQUIRE(mica::transform_noexcept<checked_double>(input, output).has_value());
+    REQUIRE(output.size() == 1000);
+    REQUIRE(output.capacity() == 1000);
+
+    REQUIRE(mica::transform_noexcept<checked_double>(std::views::iota(0, 300), output).has_value());
+    REQUIRE(output.size() == 1300);
+    REQUIRE(output.capacity() == 1300);
+}
+
+TEST_CASE("transform_noexcept input range without size")
+{
+    std::forward_list<int> input{-1, 2, 3};
+    mica::columnar_result<int> output;
+    auto&& exp = mica::transform_noexcept<checked_double>(input, output);
+    REQUIRE(exp.has_value());
+    REQUIRE(output.size() == 3);
+    REQUIRE(output.failed(0));
+    REQUIRE(output.values()[2] == 6);
+}
+
+TEST_CASE("transform_noexcept appends to output")
+{
+    mica::columnar_result<int> output;
+    REQUIRE(mica::transform_noexcept<checked_double>(std::vector<int>{1, -1}, output).has_value());
+    REQUIRE(mica::transform_noexcept<checked_double>(std::views::iota(-1, 2), output).has_value());
+    REQUIRE(output.size() == 5);
+    REQUIRE(std::ranges::equal(output.values(), std::vector<int>{2, 0, 0, 0, 2}));
+    REQUIRE(output.failure_count() == 2);
+    REQUIRE(output.errors()[1].index == 2);
+
+    output.clear();
+    REQUIRE(output.empty());
+    REQUIRE(output.failure_count() == 0);
+}
+
+TEST_CASE("transform_noexcept bool values")
+{
+    mica::columnar_result<bool> output;
+    REQUIRE(mica::transform_noexcept<checked_even>(std::views::iota(-1, 600), output).has_value());
+    REQUIRE(output.size() == 601);
+    REQUIRE(output.failed(0));
+    REQUIRE_FALSE(output.values()[0]);
+    for (std::size_t i = 1; i < output.size(); ++i) {
+        REQUIRE(output.values()[i] == (i % 2 == 1));
+    }
+    bool* first = output.values().data();
+    first[2] = true;
+    REQUIRE(output.values()[2]);
+
+    const mica::columnar_result<bool> copy = output;
+    REQUIRE(std::ranges::equal(copy.values(), output.values()));
+    REQUIRE(copy.failure_count() == 1);
+    const mica::columnar_result<bool> moved = std::move(output);
+    REQUIRE(moved.size() == 601);
+    REQUIRE(output.empty());
+
+    // Reused elements are value-initialized again
+    output = copy;
+    output.clear();
+    REQUIRE(mica::transform_noexcept<checked_even>(std::vector<int>{-1, 2}, output).has_value());
+    REQUIRE(std::ranges::equal(output.values(), std::vector<bool>{false, true}));
+}
+
+TEST_CASE("transform_noexcept translators")
+{
+    using policy = mica::translators<mica::on<std::invalid_argument, negative_message>>;
+    std::vector<int> input{-3};
+    mica::columnar_result<int, mica::error> output;
+    auto&& exp = mica::transform_noexcept<checked_double, policy>(input, output);
+    REQUIRE(exp.has_value());
+    REQUIRE(output.failure_count() == 1);
+    REQUIRE(output.errors()[0].error.category() == mica::error_category::user);
+}
+
+} // namespace mica_test
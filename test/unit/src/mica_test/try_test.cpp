@@ -22,6 +22,47 @@ void free_function_test_void_return(int a, int b) {
     free_function_test(a, b);
 }
 
+// Not default constructible, counts how often it is moved
+class tracked {
+public:
+    explicit tracked(int value) noexcept
+        : value_(value)
+    {}
+
+    tracked(const tracked&) = delete;
+
+    tracked(tracked&& other) noexcept
+        : value_(other.value_)
+    {
+        ++moves;
+    }
+
+    tracked& operator=(tracked&& other) noexcept
+    {
+        value_ = other.value_;
+        ++moves;
+        return *this;
+    }
+
+    int value() const noexcept
+    {
+        return value_;
+    }
+
+    static inline int moves = 0;
+
+private:
+    int value_;
+};
+
+std::expected<tracked, std::string> make_tracked(int value)
+{
+    if (value % 2 == 0) {
+        return std::unexpected(ERROR_MSG);
+    }
+    return std::expected<tracked, std::string>(std::in_place, value);
+}
+
 } // unnamed namespace
 
 TEST_CASE("MICA_TRY")
@@ -106,4 +147,70 @@ TEST_CASE("MICA_TRY_STATIC_VOID error")
     REQUIRE(exp.error() == "foobar error");
 }
 
+TEST_CASE("MICA_TRY_EXPR")
+{
+    tracked::moves = 0;
+    auto&& exp = []() noexcept -> std::expected<int, std::string> {
+        auto output = MICA_TRY_EXPR(make_tracked(3));
+        return output.value() + MICA_TRY_EXPR(mica::make_noexcept<free_function_test>(1, 2));
+    }();
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 6);
+    REQUIRE(tracked::moves == 1);
+}
+
+TEST_CASE("MICA_TRY_EXPR error")
+{
+    auto&& exp = []() noexcept -> std::expected<int, std::string> {
+        auto output = MICA_TRY_EXPR(make_tracked(4));
+        return output.value();
+    }();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == ERROR_MSG);
+}
+
+TEST_CASE("MICA_TRY_DECL")
+{
+    tracked::moves = 0;
+    auto&& exp = []() noexcept -> std::expected<int, std::string> {
+        MICA_TRY_DECL(tracked output, make_tracked(3));
+        return output.value();
+    }();
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 3);
+    REQUIRE(tracked::moves == 1);
+}
+
+TEST_CASE("MICA_TRY_DECL reference")
+{
+    tracked::moves = 0;
+    auto&& exp = []() noexcept -> std::expected<int, std::string> {
+        MICA_TRY_DECL(auto&& output, make_tracked(5));
+        return output.value();
+    }();
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 5);
+    REQUIRE(tracked::moves == 0);
+}
+
+TEST_CASE("MICA_TRY_DECL twice on one line")
+{
+    auto&& exp = []() noexcept -> std::expected<int, std::string> {
+        MICA_TRY_DECL(tracked first, make_tracked(3)); MICA_TRY_DECL(tracked second, make_tracked(5));
+        return first.value() + second.value();
+    }();
+    REQUIRE(exp.has_value());
+    REQUIRE(exp.value() == 8);
+}
+
+TEST_CASE("MICA_TRY_DECL error")
+{
+    auto&& exp = []() noexcept -> std::expected<int, std::string> {
+        MICA_TRY_DECL(tracked output, make_tracked(4));
+        return output.value();
+    }();
+    REQUIRE_FALSE(exp.has_value());
+    REQUIRE(exp.error() == ERROR_MSG);
+}
+
 } // namespace mica_test
@@ -0,0 +1,178 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <mica/mica.hpp>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mica_test {
+
+namespace {
+
+// Allows a fixed number of allocations, then fails
+class budget_allocator {
+public:
+    explicit budget_allocator(std::size_t allocations) noexcept
+        : allocations_(allocations)
+    {}
+
+    void* allocate(std::size_t size, std::size_t alignment) noexcept
+    {
+        if (allocations_ == 0) {
+            return nullptr;
+        }
+        --allocations_;
+        return mica::heap_allocator().allocate(size, alignment);
+    }
+
+    void deallocate(void* pointer, std::size_t size, std::size_t alignment) noexcept
+    {
+        mica::heap_allocator().deallocate(pointer, size, alignment);
+    }
+
+private:
+    std::size_t allocations_;
+};
+
+struct throwing_copy
+{
+    throwing_copy() = default;
+
+    throwing_copy(const throwing_copy&)
+    {
+        throw std::runtime_error("copy failed");
+    }
+
+    throwing_copy(throwing_copy&&) noexcept = default;
+};
+
+std::expected<int, mica::error> sum_of_first(int count) noexcept
+{
+    mica::try_vector<int> values;
+    for (int i = 1; i <= count; ++i) {
+        MICA_TRY_VOID(values.try_push_back<mica::error>(i));
+    }
+    return std::accumulate(values.begin(), values.end(), 0);
+}
+
+} // unnamed namespace
+
+TEST_CASE("try_vector push_back")
+{
+    mica::try_vector<std::string> values;
+    REQUIRE(values.empty());
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(values.try_push_back(std::to_string(i)).has_value());
+    }
+    REQUIRE(values.size() == 100);
+    REQUIRE(values.capacity() >= 100);
+    REQUIRE(values.front() == "0");
+    REQUIRE(values.back() == "99");
+    REQUIRE(values[42] == "42");
+
+    const std::string copied("copied");
+    REQUIRE(values.try_push_back(copied).has_value());
+    REQUIRE(values.back() == "copied");
+
+    REQUIRE(values.try_emplace_back(3, 'z').has_value());
+    REQUIRE(values.back() == "zzz");
+
+    values.pop_back();
+    REQUIRE(values.back() == "copied");
+}
+
+TEST_CASE("try_vector push_back own element")
+{
+    mica::try_vector<std::string> values;
+    REQUIRE(values.try_push_back(std::string(40, 'a')).has_value());
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(values.try_push_back(values.front()).has_value());
+    }
+    for (const std::string& value : values) {
+        REQUIRE(value == std::string(40, 'a'));
+    }
+}
+
+TEST_CASE("try_vector reserve and resize")
+{
+    mica::try_vector<int> values;
+    REQUIRE(values.try_reserve(16).has_value());
+    REQUIRE(values.capacity() == 16);
+    REQUIRE(values.data() != nullptr);
+
+    REQUIRE(values.try_resize(4).has_value());
+    REQUIRE(values.size() == 4);
+    REQUIRE(values[3] == 0);
+
+    REQUIRE(values.try_resize(40, 7).has_value());
+    REQUIRE(values.size() == 40);
+    REQUIRE(values[3] == 0);
+    REQUIRE(values[39] == 7);
+
+    REQUIRE(values.try_resize(2).has_value());
+    REQUIRE(values.size() == 2);
+
+    std::span<const int> view = std::as_const(values);
+    REQUIRE(view.size() == 2);
+
+    values.clear();
+    REQUIRE(values.empty());
+    REQUIRE(values.capacity() >= 40);
+}
+
+TEST_CASE("try_vector out of memory")
+{
+    mica::try_vector<int, budget_allocator> values(budget_allocator(1));
+    REQUIRE(values.try_reserve(2).has_value());
+    REQUIRE(values.try_push_back(1).has_value());
+    REQUIRE(values.try_push_back(2).has_value());
+
+    auto&& failed = values.try_push_back<mica::error>(3);
+    REQUIRE(failed.error() == mica::errc::bad_alloc);
+    REQUIRE(values.size() == 2);
+    REQUIRE(values[0] == 1);
+    REQUIRE(values[1] == 2);
+
+    REQUIRE(values.try_resize(10).error() == "bad allocation");
+    REQUIRE(values.size() == 2);
+}
+
+TEST_CASE("try_vector length error")
+{
+    mica::try_vector<int> values;
+    auto&& failed = values.try_reserve<mica::error>(mica::try_vector<int>::max_size() + 1);
+    REQUIRE(failed.error() == mica::errc::length_error);
+    REQUIRE(values.capacity() == 0);
+}
+
+TEST_CASE("try_vector constructor exception")
+{
+    mica::try_vector<throwing_copy> values;
+    REQUIRE(values.try_emplace_back().has_value());
+    const throwing_copy value;
+    REQUIRE_THROWS_AS(values.try_push_back(value), std::runtime_error);
+    REQUIRE(values.size() == 1);
+}
+
+TEST_CASE("try_vector move")
+{
+    mica::try_vector<std::unique_ptr<int>> values;
+    REQUIRE(values.try_push_back(std::make_unique<int>(5)).has_value());
+    mica::try_vector<std::unique_ptr<int>> moved(std::move(values));
+    REQUIRE(values.empty());
+    REQUIRE(*moved[0] == 5);
+
+    values = std::move(moved);
+    REQUIRE(*values[0] == 5);
+}
+
+TEST_CASE("try_vector with MICA_TRY_VOID")
+{
+    REQUIRE(sum_of_first(100).value() == 5050);
+}
+
+} // namespace mica_test